@@ -1,5 +1,7 @@
 #include "asteroid.h"
 #include "globals.h"
+#include "integrationKernel.h"
+#include "random.h"
 #include <cmath>
 #include <cstdlib>
 
@@ -8,94 +10,223 @@ static const Color ASTEROID_COLORS[] = { RED, GREEN, BLUE, YELLOW, PURPLE, ORANG
 static const int NUM_ASTEROID_COLORS = sizeof(ASTEROID_COLORS) / sizeof(ASTEROID_COLORS[0]);
 
 /**
- * Default constructor for Asteroid class
- * Initializes all member variables to default inactive state
- * Sets position, velocity, and rotation values to zero
+ * Returns the radius for an asteroid size category
+ * Used when spawning to fill the store's radius array
+ * @param size Size category of the asteroid
+ * @return Radius in pixels
  */
-Asteroid::Asteroid() {
-    active = false;
-    position = { 0.0f, 0.0f };
-    velocity = { 0.0f, 0.0f };
-    size = LARGE;
-    rotation = 0.0f;
-    rotationSpeed = 0.0f;
-    colorIndex = 0;
+static float RadiusForSize(AsteroidSize size) {
+    switch (size) {
+    case LARGE: return (float)LARGE_ASTEROID_SIZE;
+    case MEDIUM: return (float)MEDIUM_ASTEROID_SIZE;
+    case SMALL: return (float)SMALL_ASTEROID_SIZE;
+    }
+    return 0.0f;
+}
+
+/**
+ * Appends an empty (dead) asteroid slot to all hot and cold arrays
+ * @return Index of the new slot
+ */
+int AsteroidStore::Add() {
+    sizes.push_back(LARGE);
+    rotation.push_back(0.0f);
+    rotationSpeed.push_back(0.0f);
+    colorIndex.push_back(0);
+    return AddHot();
+}
+
+/**
+ * Looks up an asteroid body color from the shared palette
+ * @param colorIndex Index into the palette, wrapped to its size
+ * @return Body color
+ */
+Color AsteroidStore::PaletteColor(int colorIndex) {
+    return ASTEROID_COLORS[colorIndex % NUM_ASTEROID_COLORS];
+}
+
+/**
+ * Integrates position and rotation for a range of asteroids
+ * Position update and screen wrapping run through the batch SIMD kernel;
+ * asteroids that fully leave the screen reappear on the opposite side
+ * @param first First slot to update
+ * @param last One past the last slot to update
+ * @param deltaTime Time step in seconds
+ */
+void AsteroidStore::Integrate(int first, int last, float deltaTime) {
+    if (last <= first) return;
+
+    SavePreviousPositions(first, last);
+
+    // Update position with screen wrapping (radius is the wrap margin)
+    IntegrationKernel::IntegrateAndWrap(px.data() + first, py.data() + first,
+        vx.data() + first, vy.data() + first, radius.data() + first,
+        last - first, deltaTime);
+
+    // Update rotation
+    for (int i = first; i < last; i++) {
+        rotation[i] += rotationSpeed[i] * deltaTime;
+    }
+}
+
+/**
+ * Removes destroyed asteroids in a single stable O(n) pass
+ * Survivors keep their relative order; all slot indices are invalidated
+ * @return Number of slots reclaimed
+ */
+int AsteroidStore::Compact() {
+    int count = size();
+    int write = 0;
+
+    for (int read = 0; read < count; read++) {
+        if (!IsAlive(read)) continue;
+
+        if (write != read) {
+            MoveHot(read, write);
+            sizes[write] = sizes[read];
+            rotation[write] = rotation[read];
+            rotationSpeed[write] = rotationSpeed[read];
+            colorIndex[write] = colorIndex[read];
+        }
+        write++;
+    }
+
+    ResizeHot(write);
+    sizes.resize(write);
+    rotation.resize(write);
+    rotationSpeed.resize(write);
+    colorIndex.resize(write);
+
+    return count - write;
+}
+
+/**
+ * Reserves capacity in all hot and cold arrays
+ * @param capacity Number of asteroids to reserve
+ */
+void AsteroidStore::Reserve(int capacity) {
+    ReserveHot(capacity);
+    sizes.reserve(capacity);
+    rotation.reserve(capacity);
+    rotationSpeed.reserve(capacity);
+    colorIndex.reserve(capacity);
+}
+
+/**
+ * Removes all asteroids while keeping allocated capacity
+ */
+void AsteroidStore::clear() {
+    ResizeHot(0);
+    sizes.clear();
+    rotation.clear();
+    rotationSpeed.clear();
+    colorIndex.clear();
+}
+
+/**
+ * Returns a view onto the asteroid in the given slot
+ * @param index Slot index
+ * @return Asteroid view bound to this store
+ */
+Asteroid AsteroidStore::operator[](int index) {
+    return Asteroid(this, index);
+}
+
+/**
+ * Returns a read-only view onto the asteroid in the given slot
+ * @param index Slot index
+ * @return Const asteroid view bound to this store
+ */
+ConstAsteroid AsteroidStore::operator[](int index) const {
+    return ConstAsteroid(this, index);
+}
+
+/**
+ * Constructor for the read-only asteroid view
+ * @param owner Store holding the asteroid data
+ * @param slot Slot index inside the store
+ */
+ConstAsteroid::ConstAsteroid(const AsteroidStore* owner, int slot) : store(owner), index(slot) {
+}
+
+/**
+ * Constructor for the Asteroid view
+ * @param owner Store holding the asteroid data
+ * @param slot Slot index inside the store
+ */
+Asteroid::Asteroid(AsteroidStore* owner, int slot) : ConstAsteroid(owner, slot), writableStore(owner) {
 }
 
 /**
  * Spawns an asteroid at the specified position with given size
- * Calculates progressive speed based on global score for increased difficulty
+ * Speed and spin grow with the session's difficulty
  * Sets random movement direction, rotation speed, and color
+ * Touches only this asteroid and the given generator, so spawns of
+ * different sessions never share state
  * @param pos Starting position for the asteroid
  * @param asteroidSize Size category (LARGE, MEDIUM, or SMALL)
+ * @param speedMultiplier Difficulty factor for speed and spin (SimulationContext::GetAsteroidSpeedMultiplier)
+ * @param random Stream the asteroid's motion and color are drawn from
  */
-void Asteroid::Spawn(Vector2 pos, AsteroidSize asteroidSize) {
-    position = pos;
-    size = asteroidSize;
-    active = true;
+void Asteroid::Spawn(Vector2 pos, AsteroidSize asteroidSize, float speedMultiplier, RandomGenerator& random) {
+    writableStore->px[index] = pos.x;
+    writableStore->py[index] = pos.y;
+    writableStore->prevPx[index] = pos.x;
+    writableStore->prevPy[index] = pos.y;
+    writableStore->sizes[index] = asteroidSize;
+    writableStore->radius[index] = RadiusForSize(asteroidSize);
+    writableStore->lifetime[index] = 1.0f;
 
-    // Progressive speed based on global score
+    // Progressive speed based on the session's score
     float baseMinSpeed = ASTEROID_MIN_SPEED;
     float baseMaxSpeed = ASTEROID_MAX_SPEED;
-
-    // Speed multiplier based on global score variable
-    float speedMultiplier = 1.0f + (g_currentScore / 5000.0f); // 100% faster every 5000 points
-    speedMultiplier = SafeMin(speedMultiplier, 3.0f); // Maximum 3x as fast
-
     float minSpeed = baseMinSpeed * speedMultiplier;
     float maxSpeed = baseMaxSpeed * speedMultiplier;
 
     // Set random movement with progressive speed
-    float speed = minSpeed + static_cast<float>(rand() % static_cast<int>(maxSpeed - minSpeed + 1));
-    float angle = static_cast<float>(rand() % 360) * WINKEL2GRAD;
-    velocity.x = cosf(angle) * speed;
-    velocity.y = sinf(angle) * speed;
+    float speed = minSpeed + static_cast<float>(random.Range(0, static_cast<int>(maxSpeed - minSpeed)));
+    float angle = static_cast<float>(random.Range(0, 359)) * WINKEL2GRAD;
+    writableStore->vx[index] = cosf(angle) * speed;
+    writableStore->vy[index] = sinf(angle) * speed;
 
     // Set random rotation (also faster with progression)
-    rotation = 0.0f;
-    rotationSpeed = (static_cast<float>(rand() % 100 - 50) / 10.0f) * speedMultiplier;
+    writableStore->rotation[index] = 0.0f;
+    writableStore->rotationSpeed[index] = (static_cast<float>(random.Range(-50, 49)) / 10.0f) * speedMultiplier;
 
     // Assign random color
-    colorIndex = rand() % NUM_ASTEROID_COLORS;
+    writableStore->colorIndex[index] = random.Range(0, NUM_ASTEROID_COLORS - 1);
 }
 
 /**
- * Updates the asteroid's position and rotation each frame
- * Handles movement based on velocity and screen wrapping at boundaries
+ * Updates this asteroid's position and rotation
+ * Single-entity path; ObjectManager integrates the whole store at once
  * Only processes updates if the asteroid is active
+ * @param deltaTime Time elapsed since last frame in seconds
  */
 void Asteroid::Update(float deltaTime) {
-    if (!active) return;
-
-    // Update position
-    position.x += velocity.x * deltaTime;
-    position.y += velocity.y * deltaTime;
-
-    // Update rotation
-    rotation += rotationSpeed * deltaTime;
+    if (!IsActive()) return;
 
-    // Screen wrapping - asteroids reappear on opposite side when leaving screen
-    float radius = GetRadius();
-    if (position.x < -radius) position.x = SCREEN_WIDTH + radius;
-    if (position.x > SCREEN_WIDTH + radius) position.x = -radius;
-    if (position.y < -radius) position.y = SCREEN_HEIGHT + radius;
-    if (position.y > SCREEN_HEIGHT + radius) position.y = -radius;
+    writableStore->Integrate(index, index + 1, deltaTime);
 }
 
 /**
  * Renders the asteroid with filled body and black outline
  * Uses polygon drawing for the main body with the assigned color
  * Draws individual line segments for the border outline
+ * Single-asteroid path; the game screen draws all asteroids through AsteroidRenderer
  * Only renders if the asteroid is active
+ * @param alpha Interpolation factor between the last two simulation steps
  */
-void Asteroid::Draw() const {
-    if (!active) return;
+void ConstAsteroid::Draw(float alpha) const {
+    if (!IsActive()) return;
 
+    Vector2 position = store->GetRenderPosition(index, alpha);
     float radius = GetRadius();
+    float rotation = store->rotation[index];
     int segments = 12;
 
     // 1. Draw filled body
-    DrawPoly(position, segments, radius, rotation, ASTEROID_COLORS[colorIndex]);
+    DrawPoly(position, segments, radius, rotation, AsteroidStore::PaletteColor(store->colorIndex[index]));
 
     // 2. Draw outline (directly without helper method)
     for (int i = 0; i < segments; i++) {
@@ -114,9 +245,9 @@ void Asteroid::Draw() const {
  * Creates a square bounding box centered on the asteroid's position
  * @return Rectangle representing the asteroid's collision bounds
  */
-Rectangle Asteroid::GetBounds() const {
+Rectangle ConstAsteroid::GetBounds() const {
     float radius = GetRadius();
-    return { position.x - radius, position.y - radius, radius * 2, radius * 2 };
+    return { store->px[index] - radius, store->py[index] - radius, radius * 2, radius * 2 };
 }
 
 /**
@@ -124,8 +255,8 @@ Rectangle Asteroid::GetBounds() const {
  * Larger asteroids give fewer points, smaller ones give more points
  * @return Integer point value based on asteroid size
  */
-int Asteroid::GetPoints() const {
-    switch (size) {
+int ConstAsteroid::GetPoints() const {
+    switch (GetSize()) {
     case LARGE: return LARGE_ASTEROID_POINTS;
     case MEDIUM: return MEDIUM_ASTEROID_POINTS;
     case SMALL: return SMALL_ASTEROID_POINTS;
@@ -138,11 +269,6 @@ int Asteroid::GetPoints() const {
  * Used for collision detection, rendering, and screen wrapping calculations
  * @return Float radius value corresponding to the asteroid's size
  */
-float Asteroid::GetRadius() const {
-    switch (size) {
-    case LARGE: return (float)LARGE_ASTEROID_SIZE;
-    case MEDIUM: return (float)MEDIUM_ASTEROID_SIZE;
-    case SMALL: return (float)SMALL_ASTEROID_SIZE;
-    }
-    return 0.0f;
+float ConstAsteroid::GetRadius() const {
+    return store->radius[index];
 }
\ No newline at end of file
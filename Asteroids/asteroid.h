@@ -1,5 +1,9 @@
 #pragma once
+#include <vector>
 #include "raylib.h"
+#include "entityStore.h"
+
+class RandomGenerator;
 
 /**
  * Enumeration defining the different size categories for asteroids
@@ -11,39 +15,83 @@ enum AsteroidSize {
     SMALL    // Smallest fragments, completely destroyed when hit
 };
 
+class Asteroid;
+class ConstAsteroid;
+
 /**
- * Asteroid class representing destructible space rocks
- * Features progressive difficulty scaling, visual variety, and physics simulation
- * Supports three size categories with different behaviors and point values
+ * AsteroidStore class holding all asteroids in structure-of-arrays layout
+ * Hot movement data lives in the EntityStore arrays; rendering-only state
+ * (size, rotation, color) is kept in separate cold arrays
+ * Asteroids do not age: lifetime stays at 1 until the asteroid is destroyed
  */
-class Asteroid {
+class AsteroidStore : public EntityStore {
 public:
-    Asteroid();
-    void Spawn(Vector2 pos, AsteroidSize asteroidSize);
-    void Update(float deltaTime);
-    void Draw() const;
+    std::vector<AsteroidSize> sizes;    // Size category per asteroid
+    std::vector<float> rotation;        // Current rotation angle in degrees
+    std::vector<float> rotationSpeed;   // Angular velocity in degrees per second
+    std::vector<int> colorIndex;        // Index into color palette for visual variety
+
+    int Add();
+    void Integrate(int first /* First slot to update */,
+        int last /* One past the last slot to update */,
+        float deltaTime /* Time step in seconds */);
+    int Compact();
+    void Reserve(int capacity /* Number of asteroids to reserve */);
+    void clear();
+
+    static Color PaletteColor(int colorIndex /* Index into the asteroid color palette */);
+
+    Asteroid operator[](int index /* Slot index */);
+    ConstAsteroid operator[](int index /* Slot index */) const;
+};
+
+/**
+ * ConstAsteroid class giving read-only access to one asteroid
+ * Returned by a const AsteroidStore, so a const store cannot be changed
+ * through a copy of the view; Asteroid adds the mutating calls
+ */
+class ConstAsteroid {
+public:
+    ConstAsteroid(const AsteroidStore* owner /* Store holding the asteroid data */,
+        int slot /* Slot index inside the store */);
+    void Draw(float alpha = 1.0f /* Interpolation factor between the last two steps */) const;
     bool IsActive() const {
-        return active;
+        return store->IsAlive(index);
     }
-    Vector2 GetPosition() const { 
-        return position;
+    Vector2 GetPosition() const {
+        return { store->px[index], store->py[index] };
     }
     float GetRadius() const;
-    AsteroidSize GetSize() const { 
-        return size;
+    AsteroidSize GetSize() const {
+        return store->sizes[index];
     }
     int GetPoints() const;
     Rectangle GetBounds() const;
-    void Destroy() { 
-        active = false;
+
+protected:
+    const AsteroidStore* store;    // Store holding the asteroid data
+    int index;                     // Slot index inside the store
+};
+
+/**
+ * Asteroid class representing destructible space rocks
+ * Lightweight view onto one slot of an AsteroidStore - cheap to copy,
+ * valid until the store is compacted or grows
+ * Features progressive difficulty scaling, visual variety, and physics simulation
+ * Supports three size categories with different behaviors and point values
+ */
+class Asteroid : public ConstAsteroid {
+public:
+    Asteroid(AsteroidStore* owner /* Store holding the asteroid data */,
+        int slot /* Slot index inside the store */);
+    void Spawn(Vector2 pos, AsteroidSize asteroidSize,
+        float speedMultiplier /* Difficulty factor for speed and spin */,
+        RandomGenerator& random /* Stream the asteroid's motion and color are drawn from */);
+    void Update(float deltaTime);
+    void Destroy() {
+        writableStore->lifetime[index] = 0.0f;
     }
 
 private:
-    Vector2 position;        // Current x,y coordinates of asteroid center
-    Vector2 velocity;        // Movement speed and direction (pixels per second)
-    AsteroidSize size;       // Size category determining radius and behavior
-    float rotation;          // Current rotation angle in degrees
-    float rotationSpeed;     // Angular velocity in degrees per second
-    bool active;             // Whether asteroid is alive and should be processed
-    int colorIndex;          // Index into color palette for visual variety
-};
\ No newline at end of file
+    AsteroidStore* writableStore;  // Same store as the base view, writable
+};
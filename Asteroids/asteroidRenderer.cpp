@@ -0,0 +1,97 @@
+#include "asteroidRenderer.h"
+#include "rlgl.h"
+#include <cmath>
+
+// Unit circle vertices at 30 degree steps (12 segments, first vertex repeated)
+static constexpr Vector2 UNIT_POLYGON[] = {
+    {  1.0f,        0.0f       }, {  0.8660254f,  0.5f       }, {  0.5f,        0.8660254f },
+    {  0.0f,        1.0f       }, { -0.5f,        0.8660254f }, { -0.8660254f,  0.5f       },
+    { -1.0f,        0.0f       }, { -0.8660254f, -0.5f       }, { -0.5f,       -0.8660254f },
+    {  0.0f,       -1.0f       }, {  0.5f,       -0.8660254f }, {  0.8660254f, -0.5f       },
+    {  1.0f,        0.0f       }
+};
+static_assert(sizeof(UNIT_POLYGON) / sizeof(UNIT_POLYGON[0]) == 13, "Unit polygon needs 12 segments plus closing vertex");
+
+/**
+ * Constructor for AsteroidRenderer class
+ * Reserves vertex space for a typical asteroid field
+ */
+AsteroidRenderer::AsteroidRenderer() {
+    vertices.reserve(64 * VERTICES_PER_ASTEROID);
+}
+
+/**
+ * Draws every live asteroid with a single batched submission
+ * Builds the frame's vertex buffer first, then streams it to rlgl as one
+ * triangle list; rlgl only splits it if its internal batch buffer fills up
+ * @param asteroids Store holding all asteroids
+ * @param alpha Interpolation factor between the last two simulation steps
+ */
+void AsteroidRenderer::Draw(const AsteroidStore& asteroids, float alpha) {
+    vertices.clear();
+
+    for (int i = 0; i < asteroids.size(); i++) {
+        if (!asteroids.IsAlive(i)) continue;
+
+        AppendAsteroid(asteroids.GetRenderPosition(i, alpha), asteroids.radius[i],
+            asteroids.rotation[i], AsteroidStore::PaletteColor(asteroids.colorIndex[i]));
+    }
+
+    if (vertices.empty()) return;
+
+    rlBegin(RL_TRIANGLES);
+    for (const BatchVertex& vertex : vertices) {
+        rlColor4ub(vertex.color.r, vertex.color.g, vertex.color.b, vertex.color.a);
+        rlVertex2f(vertex.x, vertex.y);
+    }
+    rlEnd();
+}
+
+/**
+ * Transforms the unit polygon for one asteroid and appends its triangles
+ * Only one sinf/cosf pair per asteroid: the table is rotated, not recomputed
+ * Fill triangles are wound like raylib's DrawPoly (center, next, current);
+ * the outline is a ring of two triangles per edge with the same winding
+ * @param center Render position of the asteroid
+ * @param radius Asteroid radius
+ * @param rotation Rotation angle in degrees
+ * @param color Body color
+ */
+void AsteroidRenderer::AppendAsteroid(Vector2 center, float radius, float rotation, Color color) {
+    float rad = rotation * DEG2RAD;
+    float cosRot = cosf(rad);
+    float sinRot = sinf(rad);
+
+    Vector2 rim[SEGMENTS + 1];
+    for (int i = 0; i <= SEGMENTS; i++) {
+        rim[i] = {
+            UNIT_POLYGON[i].x * cosRot - UNIT_POLYGON[i].y * sinRot,
+            UNIT_POLYGON[i].x * sinRot + UNIT_POLYGON[i].y * cosRot
+        };
+    }
+
+    // Filled body
+    for (int i = 0; i < SEGMENTS; i++) {
+        vertices.push_back({ center.x, center.y, color });
+        vertices.push_back({ center.x + rim[i + 1].x * radius, center.y + rim[i + 1].y * radius, color });
+        vertices.push_back({ center.x + rim[i].x * radius, center.y + rim[i].y * radius, color });
+    }
+
+    // Outline ring
+    float inner = radius - OUTLINE_HALF_WIDTH;
+    float outer = radius + OUTLINE_HALF_WIDTH;
+    for (int i = 0; i < SEGMENTS; i++) {
+        BatchVertex innerCurrent = { center.x + rim[i].x * inner, center.y + rim[i].y * inner, BLACK };
+        BatchVertex innerNext = { center.x + rim[i + 1].x * inner, center.y + rim[i + 1].y * inner, BLACK };
+        BatchVertex outerCurrent = { center.x + rim[i].x * outer, center.y + rim[i].y * outer, BLACK };
+        BatchVertex outerNext = { center.x + rim[i + 1].x * outer, center.y + rim[i + 1].y * outer, BLACK };
+
+        vertices.push_back(innerCurrent);
+        vertices.push_back(outerNext);
+        vertices.push_back(outerCurrent);
+
+        vertices.push_back(innerCurrent);
+        vertices.push_back(innerNext);
+        vertices.push_back(outerNext);
+    }
+}
@@ -0,0 +1,40 @@
+#ifndef ASTEROIDRENDERER_H
+#define ASTEROIDRENDERER_H
+
+#include <vector>
+#include "raylib.h"
+#include "asteroid.h"
+
+/**
+ * AsteroidRenderer class drawing all asteroids in one rlgl batch
+ * Transforms a precomputed unit polygon for every live asteroid into a shared
+ * vertex buffer (filled body plus outline ring) and submits it as a single
+ * triangle list, so the draw-call count does not grow with the asteroid count
+ */
+class AsteroidRenderer {
+private:
+    struct BatchVertex {
+        float x;        // Screen position x
+        float y;        // Screen position y
+        Color color;    // Vertex color
+    };
+
+    static constexpr int SEGMENTS = 12;                 // Polygon sides per asteroid
+    static constexpr float OUTLINE_HALF_WIDTH = 1.0f;   // Half of the 2 px outline width
+    static constexpr int VERTICES_PER_ASTEROID = SEGMENTS * 3 + SEGMENTS * 6;   // Fill fan plus outline ring
+
+    std::vector<BatchVertex> vertices;   // Transformed vertices of the current frame, reused between frames
+
+    void AppendAsteroid(Vector2 center, float radius, float rotation, Color color);
+
+public:
+    AsteroidRenderer();
+
+    void Draw(const AsteroidStore& asteroids /* Store holding all asteroids */,
+        float alpha /* Interpolation factor between the last two simulation steps */);
+    int GetVertexCount() const {
+        return static_cast<int>(vertices.size());
+    }
+};
+
+#endif
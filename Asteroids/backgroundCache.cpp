@@ -0,0 +1,84 @@
+#include "backgroundCache.h"
+
+/**
+ * Constructor for BackgroundCache class
+ * No textures are created until a layer is first recorded, so the cache
+ * can be constructed before the window (and in headless runs)
+ */
+BackgroundCache::BackgroundCache() :
+    layers(),
+    width(0),
+    height(0),
+    recording(false) {
+}
+
+/**
+ * Destructor for BackgroundCache class
+ * Releases all recorded textures while the GL context is still alive
+ */
+BackgroundCache::~BackgroundCache() {
+    if (IsWindowReady()) {
+        Invalidate();
+    }
+}
+
+/**
+ * Starts recording a layer if it has not been recorded at the current resolution
+ * On true the caller draws the static content and then calls EndRecording()
+ * @param layer Layer to record
+ * @return True if the layer must be drawn now, false if the cached texture is current
+ */
+bool BackgroundCache::BeginRecording(BackgroundLayer layer) {
+    int screenWidth = GetScreenWidth();
+    int screenHeight = GetScreenHeight();
+
+    // Resolution change invalidates every layer
+    if (screenWidth != width || screenHeight != height) {
+        Invalidate();
+        width = screenWidth;
+        height = screenHeight;
+    }
+
+    if (layers[layer].id != 0) return false;
+
+    layers[layer] = LoadRenderTexture(width, height);
+    BeginTextureMode(layers[layer]);
+    ClearBackground(BLANK);
+    recording = true;
+    return true;
+}
+
+/**
+ * Finishes recording the layer started by BeginRecording()
+ */
+void BackgroundCache::EndRecording() {
+    if (!recording) return;
+
+    EndTextureMode();
+    recording = false;
+}
+
+/**
+ * Draws a recorded layer over the whole screen
+ * Render textures are stored upside down, hence the negative source height
+ * @param layer Layer to draw
+ */
+void BackgroundCache::Draw(BackgroundLayer layer) const {
+    const RenderTexture2D& target = layers[layer];
+    if (target.id == 0) return;
+
+    Rectangle source = { 0.0f, 0.0f, (float)target.texture.width, -(float)target.texture.height };
+    DrawTextureRec(target.texture, source, { 0.0f, 0.0f }, WHITE);
+}
+
+/**
+ * Releases all recorded layers; they are re-recorded on next use
+ */
+void BackgroundCache::Invalidate() {
+    for (RenderTexture2D& target : layers) {
+        if (target.id != 0) {
+            UnloadRenderTexture(target);
+            target = RenderTexture2D();
+        }
+    }
+}
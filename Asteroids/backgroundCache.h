@@ -0,0 +1,44 @@
+#ifndef BACKGROUNDCACHE_H
+#define BACKGROUNDCACHE_H
+
+#include "raylib.h"
+
+/**
+ * Static screen layers that are rendered once and reused every frame
+ */
+enum BackgroundLayer {
+    GAME_GRID_LAYER,        // Checkered grid behind the gameplay
+    OPTIONS_LAYER,          // Complete controls screen (fully static)
+    CREDITS_CHROME_LAYER,   // Credits subtitle and container frame (transparent elsewhere)
+    BACKGROUND_LAYER_COUNT
+};
+
+/**
+ * BackgroundCache class keeping static UI layers in render textures
+ * A layer is recorded on first use and then drawn as one textured quad
+ * All layers are re-recorded when the screen resolution changes
+ *
+ * Usage:
+ *   if (cache.BeginRecording(layer)) { ...draw static content...; cache.EndRecording(); }
+ *   cache.Draw(layer);
+ */
+class BackgroundCache {
+private:
+    RenderTexture2D layers[BACKGROUND_LAYER_COUNT];   // Recorded layer textures (id 0 = not recorded)
+    int width;                                        // Screen width the layers were recorded at
+    int height;                                       // Screen height the layers were recorded at
+    bool recording;                                   // Whether a texture mode is currently open
+
+public:
+    BackgroundCache();
+    ~BackgroundCache();
+    BackgroundCache(const BackgroundCache&) = delete;
+    BackgroundCache& operator=(const BackgroundCache&) = delete;
+
+    bool BeginRecording(BackgroundLayer layer /* Layer to record if it is missing or stale */);
+    void EndRecording();
+    void Draw(BackgroundLayer layer /* Layer to blit to the screen */) const;
+    void Invalidate();
+};
+
+#endif
@@ -0,0 +1,572 @@
+#include "benchmarks.h"
+#include "game.h"
+#include "objectManager.h"
+#include "collisionSystem.h"
+#include "integrationKernel.h"
+#include "jobSystem.h"
+#include "score.h"
+#include "simulationContext.h"
+#include "frameArena.h"
+#include "globals.h"
+#include "random.h"
+#include "replay.h"
+#include "rollbackSession.h"
+#include "netTransport.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+/**
+ * Returns the elapsed time since a start point in milliseconds
+ * @param start Time point the measurement started at
+ * @return Elapsed milliseconds
+ */
+static double ElapsedMs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Generator for benchmark test data, reseeded at the start of every run
+static RandomGenerator benchRandom;
+
+/**
+ * Returns a random float in [min, max) from the benchmark generator
+ * @param min Lower bound
+ * @param max Upper bound
+ * @return Random value
+ */
+static float RandomRange(float min, float max) {
+    return benchRandom.Range(min, max);
+}
+
+/**
+ * Fills an array with random floats from the benchmark generator
+ * @param values Array to fill
+ * @param min Lower bound
+ * @param max Upper bound
+ */
+static void FillRandom(std::vector<float>& values, float min, float max) {
+    for (float& value : values) value = RandomRange(min, max);
+}
+
+/**
+ * Asteroid layout before the structure-of-arrays store, kept as reference
+ * for the update benchmark
+ */
+struct LegacyAsteroid {
+    Vector2 position;       // Current position in world coordinates
+    Vector2 previous;       // Position before the last step, for interpolation
+    Vector2 velocity;       // Movement velocity in pixels per second
+    AsteroidSize size;      // Size category
+    float radius;           // Collision radius, also the wrap margin
+    float rotation;         // Current rotation angle in degrees
+    float rotationSpeed;    // Angular velocity in degrees per second
+    bool active;            // Whether the asteroid is alive
+    int colorIndex;         // Index into color palette
+};
+
+/**
+ * Fills the object manager with a random field of asteroids and projectiles
+ * Projectiles are added directly to the store to bypass the firing limit
+ * @param objectManager Object manager to fill
+ * @param asteroidCount Number of asteroids to spawn
+ * @param projectileCount Number of projectiles to spawn
+ */
+static void FillField(ObjectManager& objectManager, int asteroidCount, int projectileCount) {
+    objectManager.ResetObjects();
+    for (int i = 0; i < asteroidCount; i++) {
+        Vector2 pos = { RandomRange(0.0f, SCREEN_WIDTH), RandomRange(0.0f, SCREEN_HEIGHT) };
+        objectManager.SpawnAsteroid(pos, (AsteroidSize)benchRandom.Range(0, 2));
+    }
+    objectManager.ApplyPendingCommands();
+
+    ProjectileStore& projectiles = objectManager.GetProjectilesMutable();
+    if (projectileCount > projectiles.GetPoolCapacity()) {
+        objectManager.SetProjectileCapacity(projectileCount);
+    }
+    for (int i = 0; i < projectileCount; i++) {
+        int slot = projectiles.Add();
+        Vector2 pos = { RandomRange(0.0f, SCREEN_WIDTH), RandomRange(0.0f, SCREEN_HEIGHT) };
+        projectiles[slot].Fire(pos, RandomRange(0.0f, 360.0f));
+    }
+}
+
+/**
+ * Prints the outcome of one projectile handle check
+ * @param name Check description
+ * @param passed Whether the check passed
+ * @return The outcome, for accumulating
+ */
+static bool ReportHandleCheck(const char* name, bool passed) {
+    printf("Handles %-36s %s\n", name, passed ? "OK" : "FAILED");
+    return passed;
+}
+
+namespace Benchmarks {
+
+    /**
+     * Measures CheckCollisions with the broadphase grid against the brute force path
+     * Both modes replay the same field from the same seed; the field is refilled
+     * every frame so destroyed asteroids do not shrink the workload
+     * @param asteroidCount Asteroids in the field
+     * @param projectileCount Projectiles in flight
+     * @param frames Frames to measure per mode
+     * @param seed Random seed, same for both modes
+     */
+    void RunCollisionBenchmark(int asteroidCount, int projectileCount, int frames, unsigned int seed) {
+        Spaceship player;
+        SimulationContext context(seed);
+        ObjectManager objectManager(&player, 1, context);
+        CollisionSystem collisionSystem(objectManager, context.GetScore());
+        FrameArena frameArena;
+        collisionSystem.SetFrameArena(&frameArena);
+
+        printf("Collision benchmark: %d asteroids, %d projectiles, %d frames\n",
+            asteroidCount, projectileCount, frames);
+
+        double bruteForceMs = 0.0;
+        for (int mode = 0; mode < 2; mode++) {
+            bool broadphase = mode == 1;
+            collisionSystem.SetBroadphaseEnabled(broadphase);
+            benchRandom.Seed(seed);
+            context.Seed(seed);
+
+            double totalMs = 0.0;
+            int hits = 0;
+            for (int frame = 0; frame < frames; frame++) {
+                FillField(objectManager, asteroidCount, projectileCount);
+
+                auto start = std::chrono::steady_clock::now();
+                collisionSystem.CheckCollisions(true, true);
+                totalMs += ElapsedMs(start);
+
+                for (int i = 0; i < objectManager.GetProjectiles().size(); i++) {
+                    if (!objectManager.GetProjectiles().IsAlive(i)) hits++;
+                }
+                objectManager.ApplyPendingCommands();
+                frameArena.Reset();
+            }
+
+            double frameMs = totalMs / frames;
+            printf("  %-12s %8.4f ms/frame  (%d hits)\n",
+                broadphase ? "Broadphase" : "Brute force", frameMs, hits);
+            if (broadphase && frameMs > 0.0) {
+                printf("  Speedup      %8.2fx\n", bruteForceMs / frameMs);
+            }
+            bruteForceMs = frameMs;
+        }
+    }
+
+    /**
+     * Measures asteroid integration throughput for the legacy array-of-structs
+     * layout and the structure-of-arrays store at every supported kernel level
+     * Both sides do the work of AsteroidStore::Integrate: save the previous
+     * position, integrate, wrap at the radius and rotate
+     * @param entityCount Entities to integrate
+     * @param frames Frames to measure per layout
+     * @param seed Random seed for the initial state
+     */
+    void RunUpdateBenchmark(int entityCount, int frames, unsigned int seed) {
+        const float deltaTime = 1.0f / 60.0f;
+        benchRandom.Seed(seed);
+
+        std::vector<LegacyAsteroid> legacy(entityCount);
+        AsteroidStore store;
+        store.Reserve(entityCount);
+        for (int i = 0; i < entityCount; i++) {
+            LegacyAsteroid& a = legacy[i];
+            a.position = { RandomRange(0.0f, SCREEN_WIDTH), RandomRange(0.0f, SCREEN_HEIGHT) };
+            a.velocity = { RandomRange(-100.0f, 100.0f), RandomRange(-100.0f, 100.0f) };
+            a.previous = a.position;
+            a.size = (AsteroidSize)benchRandom.Range(0, 2);
+            a.radius = 40.0f;
+            a.rotation = 0.0f;
+            a.rotationSpeed = RandomRange(-90.0f, 90.0f);
+            a.active = true;
+            a.colorIndex = 0;
+
+            int slot = store.Add();
+            store.px[slot] = a.position.x;
+            store.py[slot] = a.position.y;
+            store.vx[slot] = a.velocity.x;
+            store.vy[slot] = a.velocity.y;
+            store.radius[slot] = a.radius;
+            store.lifetime[slot] = 1.0f;
+            store.sizes[slot] = a.size;
+            store.rotationSpeed[slot] = a.rotationSpeed;
+        }
+
+        printf("Update benchmark: %d asteroids, %d frames\n", entityCount, frames);
+
+        auto start = std::chrono::steady_clock::now();
+        for (int frame = 0; frame < frames; frame++) {
+            for (LegacyAsteroid& a : legacy) {
+                if (!a.active) continue;
+                a.previous = a.position;
+                a.position.x += a.velocity.x * deltaTime;
+                a.position.y += a.velocity.y * deltaTime;
+                a.rotation += a.rotationSpeed * deltaTime;
+
+                float margin = a.radius;
+                if (a.position.x < -margin) a.position.x = SCREEN_WIDTH + margin;
+                if (a.position.x > SCREEN_WIDTH + margin) a.position.x = -margin;
+                if (a.position.y < -margin) a.position.y = SCREEN_HEIGHT + margin;
+                if (a.position.y > SCREEN_HEIGHT + margin) a.position.y = -margin;
+            }
+        }
+        double legacyMs = ElapsedMs(start) / frames;
+        printf("  %-12s %8.4f ms/frame  %8.1f M entities/s\n", "AoS",
+            legacyMs, entityCount / (legacyMs * 1000.0));
+
+        KernelLevel previous = IntegrationKernel::GetActiveLevel();
+        for (int level = KERNEL_SCALAR; level <= IntegrationKernel::GetDetectedLevel(); level++) {
+            IntegrationKernel::SetActiveLevel((KernelLevel)level);
+
+            start = std::chrono::steady_clock::now();
+            for (int frame = 0; frame < frames; frame++) {
+                store.Integrate(0, store.size(), deltaTime);
+            }
+            double storeMs = ElapsedMs(start) / frames;
+
+            char label[32];
+            snprintf(label, sizeof(label), "SoA %s", IntegrationKernel::GetLevelName((KernelLevel)level));
+            printf("  %-12s %8.4f ms/frame  %8.1f M entities/s\n", label,
+                storeMs, entityCount / (storeMs * 1000.0));
+        }
+        IntegrationKernel::SetActiveLevel(previous);
+    }
+
+    /**
+     * Measures integration plus broadphase rebuild on 1 to N threads
+     * Every thread count starts from the same field; the positions and a set
+     * of grid queries are hashed and must match the single-threaded run
+     * @param entityCount Asteroids to update
+     * @param frames Frames to measure per thread count
+     * @param maxThreads Highest thread count, 0 for the hardware threads
+     * @param seed Random seed, same for every thread count
+     */
+    void RunParallelBenchmark(int entityCount, int frames, int maxThreads, unsigned int seed) {
+        const float deltaTime = 1.0f / 60.0f;
+        Spaceship player;
+        SimulationContext context(seed);
+        ObjectManager objectManager(&player, 1, context);
+        CollisionSystem collisionSystem(objectManager, context.GetScore());
+        std::vector<int> results;
+
+        int hardwareThreads = std::max(1, (int)std::thread::hardware_concurrency());
+        if (maxThreads <= 0) maxThreads = hardwareThreads;
+        printf("Parallel benchmark: %d asteroids, %d frames, %d hardware threads\n",
+            entityCount, frames, hardwareThreads);
+
+        // 1, 2, 4, ... threads, always ending with the highest thread count
+        std::vector<int> threadCounts;
+        for (int threads = 1; threads < maxThreads; threads *= 2) threadCounts.push_back(threads);
+        threadCounts.push_back(maxThreads);
+
+        double serialMs = 0.0;
+        uint32_t serialHash = 0;
+        for (int threads : threadCounts) {
+            JobSystem jobs(threads - 1);
+            objectManager.SetJobSystem(&jobs);
+            collisionSystem.SetJobSystem(&jobs);
+            benchRandom.Seed(seed);
+            context.Seed(seed);
+            FillField(objectManager, entityCount, 0);
+
+            auto start = std::chrono::steady_clock::now();
+            for (int frame = 0; frame < frames; frame++) {
+                objectManager.UpdateObjects(deltaTime);
+                collisionSystem.BuildAsteroidGrid();
+            }
+            double frameMs = ElapsedMs(start) / frames;
+
+            // FNV-1a over the final positions and a sweep of grid queries
+            uint32_t hash = 2166136261u;
+            const AsteroidStore& asteroids = objectManager.GetAsteroids();
+            for (int i = 0; i < asteroids.size(); i++) {
+                uint32_t bits[2];
+                memcpy(&bits[0], &asteroids.px[i], sizeof(float));
+                memcpy(&bits[1], &asteroids.py[i], sizeof(float));
+                hash = (hash ^ bits[0]) * 16777619u;
+                hash = (hash ^ bits[1]) * 16777619u;
+            }
+            for (float y = 0.0f; y < SCREEN_HEIGHT; y += 100.0f) {
+                for (float x = 0.0f; x < SCREEN_WIDTH; x += 100.0f) {
+                    collisionSystem.GetAsteroidGrid().Query({ x, y, 10.0f, 10.0f }, results);
+                    for (int id : results) hash = (hash ^ (uint32_t)id) * 16777619u;
+                }
+            }
+
+            if (threads == 1) {
+                serialMs = frameMs;
+                serialHash = hash;
+            }
+            printf("  %2d threads   %8.4f ms/frame  %6.2fx  %s\n", threads, frameMs,
+                frameMs > 0.0 ? serialMs / frameMs : 0.0, hash == serialHash ? "match" : "MISMATCH");
+
+            objectManager.SetJobSystem(nullptr);
+            collisionSystem.SetJobSystem(nullptr);
+        }
+    }
+
+    /**
+     * Measures world snapshot save and restore and checks the round trip
+     * The world is saved, simulated for a while, restored and simulated again;
+     * both runs must end in the same state checksum
+     * @param entityCount Asteroids plus projectiles in the world
+     * @param iterations Save/restore pairs to time
+     * @param seed Random seed for the world
+     * @return True if restoring reproduced the simulation exactly
+     */
+    bool RunSnapshotBenchmark(int entityCount, int iterations, unsigned int seed) {
+        const int verifyTicks = 2 * SIMULATION_RATE;
+        Game game(true);
+        game.SeedRandom(seed);
+        game.Initialize();
+        game.StartNewGame();
+
+        benchRandom.Seed(seed);
+        int projectileCount = entityCount / 10;
+        FillField(game.GetObjectManager(), entityCount - projectileCount, projectileCount);
+
+        WorldSnapshot snapshot;
+        game.SaveWorld(snapshot);
+        uint32_t savedChecksum = game.ComputeStateChecksum();
+        for (int tick = 0; tick < verifyTicks; tick++) game.Tick(FIXED_TIME_STEP);
+        uint32_t firstRun = game.ComputeStateChecksum();
+
+        game.RestoreWorld(snapshot);
+        bool restored = game.ComputeStateChecksum() == savedChecksum;
+        for (int tick = 0; tick < verifyTicks; tick++) game.Tick(FIXED_TIME_STEP);
+        bool replayed = game.ComputeStateChecksum() == firstRun;
+        game.RestoreWorld(snapshot);
+
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++) game.SaveWorld(snapshot);
+        double saveUs = ElapsedMs(start) * 1000.0 / iterations;
+
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++) game.RestoreWorld(snapshot);
+        double restoreUs = ElapsedMs(start) * 1000.0 / iterations;
+
+        printf("Snapshot benchmark: %d entities, %d bytes\n", entityCount, (int)snapshot.GetSize());
+        printf("  Save         %8.2f us\n", saveUs);
+        printf("  Restore      %8.2f us\n", restoreUs);
+        printf("  Round trip   %s\n", restored && replayed ? "match" : "MISMATCH");
+        return restored && replayed;
+    }
+
+    /**
+     * Plays a multiplayer match with one rollback session per player
+     * Every player runs its own copy of the world; pilots change input every
+     * 15 ticks, so remote predictions fail regularly and force rollbacks.
+     * After the last tick all sessions are synchronized and must agree on
+     * the world checksum
+     * @param players Ships in the match
+     * @param ticks Ticks every session simulates
+     * @param latencyTicks Network delay in ticks (in-process network only)
+     * @param useUdp Exchange input over UDP loopback sockets instead
+     * @param seed Match seed
+     * @return True if all sessions ended with the same world
+     */
+    bool RunRollbackBenchmark(int players, int ticks, int latencyTicks, bool useUdp, unsigned int seed) {
+        const int basePort = 47400;
+        InProcessNetwork network(players, latencyTicks);
+        std::vector<std::unique_ptr<InputTransport>> transports;
+        for (int player = 0; player < players; player++) {
+            if (!useUdp) {
+                transports.emplace_back(new InProcessTransport(network, player));
+                continue;
+            }
+
+            std::vector<int> peers;
+            for (int peer = 0; peer < players; peer++) {
+                if (peer != player) peers.push_back(basePort + peer);
+            }
+            UdpLoopbackTransport* udp = new UdpLoopbackTransport();
+            transports.emplace_back(udp);
+            if (!udp->Open(basePort + player, peers)) {
+                printf("Rollback benchmark: UDP loopback port %d unavailable, skipped\n", basePort + player);
+                return true;
+            }
+        }
+
+        std::vector<std::unique_ptr<RollbackSession>> sessions;
+        for (int player = 0; player < players; player++) {
+            sessions.emplace_back(new RollbackSession(players, player, *transports[player], seed));
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        int rounds = 0;
+        bool running = true;
+        while (running && rounds < ticks * 4 + 1000) {
+            running = false;
+            for (int player = 0; player < players; player++) {
+                RollbackSession& session = *sessions[player];
+                if (session.GetTick() < ticks) {
+                    session.AdvanceTick(ReplayKeys::PilotMask(seed, player, session.GetTick()));
+                    running = true;
+                }
+            }
+            network.Advance();
+            rounds++;
+        }
+        double elapsedMs = ElapsedMs(start);
+
+        // Deliver the inputs still in flight and apply the last corrections
+        for (int flush = 0; flush < 1000; flush++) {
+            bool confirmed = true;
+            for (auto& session : sessions) {
+                session->Synchronize();
+                confirmed = confirmed && session->GetConfirmedTick() == ticks;
+            }
+            if (confirmed) break;
+            network.Advance();
+        }
+
+        RollbackStats total;
+        bool match = true;
+        for (auto& session : sessions) {
+            const RollbackStats& stats = session->GetStats();
+            total.ticks += stats.ticks;
+            total.rollbacks += stats.rollbacks;
+            total.resimulatedTicks += stats.resimulatedTicks;
+            total.resimulateMs += stats.resimulateMs;
+            total.worstRollbackMs = std::max(total.worstRollbackMs, stats.worstRollbackMs);
+            total.stalls += stats.stalls;
+            total.latencyTicks += stats.latencyTicks;
+            total.worstLatencyTicks = std::max(total.worstLatencyTicks, stats.worstLatencyTicks);
+            total.remoteInputs += stats.remoteInputs;
+            match = match && session->GetConfirmedTick() == ticks
+                && session->ComputeChecksum() == sessions[0]->ComputeChecksum();
+        }
+
+        const double msPerTick = 1000.0 / SIMULATION_RATE;
+        double averageLatency = total.remoteInputs > 0 ? (double)total.latencyTicks / total.remoteInputs : 0.0;
+        printf("Rollback benchmark: %d players, %s, %d ticks\n", players,
+            useUdp ? "UDP loopback" : "in-process", ticks);
+        if (!useUdp) printf("  Network delay      %6d ticks (%.1f ms)\n", latencyTicks, latencyTicks * msPerTick);
+        printf("  Rollbacks          %6d (%.1f ticks re-simulated on average)\n", total.rollbacks,
+            total.rollbacks > 0 ? (double)total.resimulatedTicks / total.rollbacks : 0.0);
+        printf("  Re-sim per tick    %8.4f ms (worst rollback %.3f ms)\n",
+            total.ticks > 0 ? total.resimulateMs / total.ticks : 0.0, total.worstRollbackMs);
+        printf("  Session tick       %8.4f ms (all work incl. rollbacks)\n",
+            total.ticks > 0 ? elapsedMs / total.ticks : 0.0);
+        printf("  Input latency      %6.2f ticks (%.1f ms), worst %d ticks\n",
+            averageLatency, averageLatency * msPerTick, total.worstLatencyTicks);
+        printf("  Stalls             %6d\n", total.stalls);
+        printf("  Checksums          %s\n", match ? "match" : "MISMATCH");
+        return match;
+    }
+
+    /**
+     * Checks every supported SIMD kernel against the scalar reference
+     * Uses random positions near and beyond the wrap borders so both wrap
+     * branches and the remainder loop are exercised; results must match bit for bit
+     * @param entityCount Entities per verification batch
+     * @param seed Random seed for the test data
+     * @return True if all kernels match the scalar reference
+     */
+    bool VerifyKernels(int entityCount, unsigned int seed) {
+        benchRandom.Seed(seed);
+        std::vector<float> px(entityCount), py(entityCount), vx(entityCount), vy(entityCount), margin(entityCount);
+        FillRandom(px, -100.0f, SCREEN_WIDTH + 100.0f);
+        FillRandom(py, -100.0f, SCREEN_HEIGHT + 100.0f);
+        FillRandom(vx, -5000.0f, 5000.0f);
+        FillRandom(vy, -5000.0f, 5000.0f);
+        FillRandom(margin, 0.0f, 50.0f);
+
+        KernelLevel previous = IntegrationKernel::GetActiveLevel();
+        bool allMatch = true;
+
+        for (int level = KERNEL_SSE2; level <= IntegrationKernel::GetDetectedLevel(); level++) {
+            for (int withMargin = 0; withMargin < 2; withMargin++) {
+                const float* m = withMargin ? margin.data() : nullptr;
+                std::vector<float> refX = px, refY = py, testX = px, testY = py;
+
+                IntegrationKernel::IntegrateAndWrapScalar(refX.data(), refY.data(),
+                    vx.data(), vy.data(), m, entityCount, 1.0f / 60.0f);
+
+                IntegrationKernel::SetActiveLevel((KernelLevel)level);
+                IntegrationKernel::IntegrateAndWrap(testX.data(), testY.data(),
+                    vx.data(), vy.data(), m, entityCount, 1.0f / 60.0f);
+
+                int mismatches = 0;
+                for (int i = 0; i < entityCount; i++) {
+                    if (memcmp(&refX[i], &testX[i], sizeof(float)) != 0 ||
+                        memcmp(&refY[i], &testY[i], sizeof(float)) != 0) {
+                        mismatches++;
+                    }
+                }
+
+                printf("Kernel %-6s %-10s %s (%d mismatches)\n",
+                    IntegrationKernel::GetLevelName((KernelLevel)level),
+                    withMargin ? "margin" : "no margin",
+                    mismatches == 0 ? "OK" : "FAILED", mismatches);
+                if (mismatches > 0) allMatch = false;
+            }
+        }
+
+        IntegrationKernel::SetActiveLevel(previous);
+        return allMatch;
+    }
+
+    /**
+     * Checks that projectile handles detect reclaimed and reused pool slots
+     * Fires through the object manager of a headless game, so the same
+     * paths as the simulation are exercised: compaction, free-list reuse,
+     * a full pool and a world snapshot restore
+     * @param seed Random seed of the game
+     * @return True if every check passed
+     */
+    bool VerifyProjectileHandles(unsigned int seed) {
+        Game game(true);
+        game.SeedRandom(seed);
+        game.Initialize();
+        game.StartNewGame();
+
+        ObjectManager& objectManager = game.GetObjectManager();
+        objectManager.ResetObjects();
+        ProjectileStore& projectiles = objectManager.GetProjectilesMutable();
+        bool allPassed = true;
+
+        // Expire the first of two shots; only its handle goes stale
+        ProjectileHandle expired = objectManager.FireProjectile({ 100.0f, 100.0f }, 0.0f);
+        ProjectileHandle survivor = objectManager.FireProjectile({ 200.0f, 200.0f }, 90.0f);
+        projectiles[projectiles.Resolve(expired)].Deactivate();
+        objectManager.CompactObjects();
+        allPassed &= ReportHandleCheck("expired shot resolves to nothing",
+            projectiles.Resolve(expired) == -1);
+        allPassed &= ReportHandleCheck("survivor follows compaction",
+            projectiles.Resolve(survivor) == 0 && projectiles[0].GetPosition().x == 200.0f);
+
+        // The freed handle slot is the head of the free list
+        ProjectileHandle reused = objectManager.FireProjectile({ 300.0f, 300.0f }, 180.0f);
+        allPassed &= ReportHandleCheck("reused slot gets a new generation",
+            reused.slot == expired.slot && reused.generation != expired.generation &&
+            projectiles.Resolve(reused) >= 0 && projectiles.Resolve(expired) == -1);
+
+        // Fill the pool; the next shot must be refused without growing it
+        int capacity = projectiles.GetPoolCapacity();
+        while (projectiles.size() < capacity) {
+            objectManager.FireProjectile({ 400.0f, 400.0f }, RandomRange(0.0f, 360.0f));
+        }
+        ProjectileHandle refused = objectManager.FireProjectile({ 400.0f, 400.0f }, 0.0f);
+        allPassed &= ReportHandleCheck("full pool returns an invalid handle",
+            !refused.IsValid() && projectiles.IsFull() &&
+            projectiles.size() == capacity && projectiles.GetPoolCapacity() == capacity);
+
+        // Restoring a snapshot renumbers the handles of the restored shots
+        WorldSnapshot snapshot;
+        game.SaveWorld(snapshot);
+        ProjectileHandle beforeRestore = projectiles.GetHandle(0);
+        game.RestoreWorld(snapshot);
+        allPassed &= ReportHandleCheck("restore makes earlier handles stale",
+            projectiles.Resolve(beforeRestore) == -1 && projectiles.Resolve(survivor) == -1 &&
+            projectiles.Resolve(projectiles.GetHandle(0)) == 0);
+
+        return allPassed;
+    }
+}
@@ -0,0 +1,30 @@
+#ifndef BENCHMARKS_H
+#define BENCHMARKS_H
+
+// Micro-benchmarks and self-checks run by the headless target
+namespace Benchmarks {
+    void RunCollisionBenchmark(int asteroidCount /* Asteroids in the field */,
+        int projectileCount /* Projectiles in flight */,
+        int frames /* Frames to measure per mode */,
+        unsigned int seed /* Random seed, same for both modes */);
+    void RunUpdateBenchmark(int entityCount /* Entities to integrate */,
+        int frames /* Frames to measure per layout */,
+        unsigned int seed /* Random seed for the initial state */);
+    void RunParallelBenchmark(int entityCount /* Asteroids to update */,
+        int frames /* Frames to measure per thread count */,
+        int maxThreads /* Highest thread count, 0 = hardware threads */,
+        unsigned int seed /* Random seed, same for every thread count */);
+    bool RunSnapshotBenchmark(int entityCount /* Asteroids plus projectiles in the world */,
+        int iterations /* Save/restore pairs to time */,
+        unsigned int seed /* Random seed for the world */);
+    bool RunRollbackBenchmark(int players /* Ships in the match */,
+        int ticks /* Ticks every session simulates */,
+        int latencyTicks /* Network delay in ticks (in-process network only) */,
+        bool useUdp /* Exchange input over UDP loopback instead of in-process */,
+        unsigned int seed /* Match seed */);
+    bool VerifyKernels(int entityCount /* Entities per verification batch */,
+        unsigned int seed /* Random seed for the test data */);
+    bool VerifyProjectileHandles(unsigned int seed /* Random seed of the game */);
+}
+
+#endif
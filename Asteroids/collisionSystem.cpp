@@ -1,126 +1,314 @@
 #include "collisionSystem.h"
 #include "globals.h"
+#include "jobSystem.h"
+#include "narrowphase.h"
+#include "profiler.h"
+#include "random.h"
+#include "simulationContext.h"
+#include <algorithm>
+#include <cmath>
+
 
 /**
  * Constructor for CollisionSystem class
  * Initializes references to object manager and scoring system
+ * Sets up the broadphase grid covering the wrapping play field and sizes
+ * its buffers up front, so a steady frame does not grow them
  * @param objMgr Reference to the object manager for accessing game objects
  * @param score Reference to the scoring system for awarding points
  */
 CollisionSystem::CollisionSystem(ObjectManager& objMgr, Score& score) :
     objectManager(objMgr),
-    gameScore(score) {
+    gameScore(score),
+    asteroidGrid(COLLISION_CELL_SIZE, (float)SCREEN_WIDTH, (float)SCREEN_HEIGHT),
+    broadphaseEnabled(true),
+    jobs(nullptr),
+    frameArena(nullptr) {
+    candidates.reserve(64);
+    hits.reserve(16);
+    asteroidBounds.reserve(RESERVED_ASTEROIDS);
+    asteroidGrid.Reserve(RESERVED_ASTEROIDS, 4);
 }
 
 /**
  * Main collision detection method called each frame
- * Coordinates all collision checks between different object types
+ * Rebuilds the asteroid broadphase grid once, then runs all collision checks
+ * Destroys, fragments and drops are queued on the object manager and take
+ * effect at its next ApplyPendingCommands() sync point
  * Handles shield protection and invulnerability states
  * @param hasShield Whether the player currently has shield protection
  * @param isInvulnerable Whether the player is currently invulnerable
  */
 void CollisionSystem::CheckCollisions(bool hasShield, bool isInvulnerable) {
+    PROFILE_SCOPE(ZONE_COLLISIONS);
+    BeginSweep();
+
     CheckProjectileAsteroidCollisions();
-    CheckPlayerAsteroidCollisions(hasShield, isInvulnerable);
+    CheckShipAsteroidCollisions(objectManager.GetPlayer(), isInvulnerable);
+}
+
+/**
+ * Collision detection for sessions with several ships
+ * Runs the same checks as the single-player overload; ships are tested
+ * against the asteroids in array order, and ships without lives are skipped
+ * @param ships Ships of the session
+ * @param shipCount Number of ships
+ */
+void CollisionSystem::CheckCollisions(Spaceship* ships, int shipCount) {
+    PROFILE_SCOPE(ZONE_COLLISIONS);
+    BeginSweep();
+
+    CheckProjectileAsteroidCollisions();
+    for (int i = 0; i < shipCount; i++) {
+        if (ships[i].GetLives() <= 0) continue;
+        CheckShipAsteroidCollisions(ships[i], ships[i].IsInvulnerable());
+    }
+}
+
+/**
+ * Resets the per-sweep asteroid claims and rebuilds the broadphase grid
+ * With a frame arena the contact and claim lists are taken fresh from it,
+ * since the previous sweep's storage was released by the arena's last
+ * Reset(); on the heap they keep their capacity from sweep to sweep
+ */
+void CollisionSystem::BeginSweep() {
+    int asteroidCount = objectManager.GetAsteroids().size();
+    if (frameArena || contacts.get_allocator().arena) {
+        contacts = ArenaVector<CollisionContact>(ArenaAllocator<CollisionContact>(frameArena));
+        contacts.reserve(64);
+        claimedAsteroids = ArenaVector<unsigned char>(asteroidCount, 0, ArenaAllocator<unsigned char>(frameArena));
+    }
+    else {
+        contacts.clear();
+        claimedAsteroids.assign(asteroidCount, 0);
+    }
+
+    if (broadphaseEnabled) {
+        BuildAsteroidGrid();
+    }
+}
+
+/**
+ * Rebuilds the broadphase grid from the current asteroid vector
+ * Inserts every active asteroid by index using its collision bounds
+ * Bounds and cell lists are computed on the job system when one is set;
+ * the grid comes out identical to the serial build
+ * Asteroids spawned later in the frame are picked up on the next rebuild
+ */
+void CollisionSystem::BuildAsteroidGrid() {
+    const auto& asteroids = objectManager.GetAsteroids();
+    int count = asteroids.size();
+    asteroidBounds.resize(count);
+
+    auto gatherBounds = [&](int first, int last) {
+        for (int i = first; i < last; i++) {
+            // Negative width marks dead asteroids for the rebuild to skip
+            asteroidBounds[i] = asteroids.IsAlive(i) ? asteroids[i].GetBounds() : Rectangle{ 0, 0, -1, -1 };
+        }
+    };
+    if (jobs) {
+        jobs->ParallelFor(0, count, PARALLEL_GRAIN, gatherBounds);
+    }
+    else {
+        gatherBounds(0, count);
+    }
+
+    asteroidGrid.Rebuild(asteroidBounds.data(), count, jobs);
 }
 
 /**
  * Checks collisions between all active projectiles and asteroids
- * Handles asteroid destruction, fragmentation into smaller pieces
- * Awards points based on asteroid size and manages power-up spawning
- * Prevents multiple collisions per frame for stability
+ * Gathers every contact in one sweep, then resolves them in deterministic order
+ * Clears all contacts in a single frame, even under rapid fire
  */
 void CollisionSystem::CheckProjectileAsteroidCollisions() {
-    auto& projectiles = const_cast<std::vector<Projectile>&>(objectManager.GetProjectiles());
-    auto& asteroids = const_cast<std::vector<Asteroid>&>(objectManager.GetAsteroids());
-
-    bool collisionFound = false;
-
-    for (auto& projectile : projectiles) {
-        if (!projectile.IsActive() || collisionFound) continue;
-
-        for (auto& asteroid : asteroids) {
-            if (!asteroid.IsActive()) continue;
-
-            if (CheckCollisionRecs(projectile.GetBounds(), asteroid.GetBounds())) {
-                // IMMEDIATELY deactivate both objects to prevent multiple collisions
-                projectile.Deactivate();
-
-                // Save data before deactivation
-                Vector2 asteroidPos = asteroid.GetPosition();
-                AsteroidSize currentSize = asteroid.GetSize();
-                int points = asteroid.GetPoints();
-
-                // IMMEDIATELY deactivate asteroid
-                asteroid.Destroy();
-
-                // Add points
-                gameScore.AddPoints(points);
-
-                // Spawn smaller asteroids - but only once!
-                if (currentSize == LARGE) {
-                    // Slightly offset positions to avoid overlap
-                    Vector2 pos1 = { asteroidPos.x + 20, asteroidPos.y + 20 };
-                    Vector2 pos2 = { asteroidPos.x - 20, asteroidPos.y - 20 };
-                    objectManager.SpawnAsteroid(pos1, MEDIUM);
-                    objectManager.SpawnAsteroid(pos2, MEDIUM);
-                }
-                else if (currentSize == MEDIUM) {
-                    // Slightly offset positions to avoid overlap
-                    Vector2 pos1 = { asteroidPos.x + 15, asteroidPos.y + 15 };
-                    Vector2 pos2 = { asteroidPos.x - 15, asteroidPos.y - 15 };
-                    objectManager.SpawnAsteroid(pos1, SMALL);
-                    objectManager.SpawnAsteroid(pos2, SMALL);
-                }
-                // SMALL asteroids spawn nothing
-
-                // Power-up spawn chance (only for large asteroids)
-                if (currentSize == LARGE && GetRandomValue(0, 100) < 20) { // 20% chance
-                    PowerUpType randomType = static_cast<PowerUpType>(GetRandomValue(0, 2));
-                    objectManager.SpawnPowerUp(asteroidPos, randomType);
-                }
-
-                collisionFound = true;
-                break;
-            }
+    GatherProjectileContacts();
+    ResolveProjectileContacts();
+}
+
+/**
+ * Collects every projectile-asteroid hit without changing any state
+ * Each projectile is swept along the segment from its previous to its current
+ * position, so fast shots cannot skip over small asteroids at low tick rates
+ * A step that wrapped around the screen is split into the part before the
+ * crossed edge and its continuation on the opposite side
+ * Projectiles are walked in vector order and each projectile's hits are sorted
+ * by impact time, then asteroid index, so the contact list is deterministic
+ */
+void CollisionSystem::GatherProjectileContacts() {
+    const auto& projectiles = objectManager.GetProjectiles();
+
+    contacts.clear();
+
+    for (int p = 0; p < projectiles.size(); p++) {
+        if (!projectiles.IsAlive(p)) continue;
+
+        Vector2 start = { projectiles.prevPx[p], projectiles.prevPy[p] };
+        Vector2 end = { projectiles.px[p], projectiles.py[p] };
+        float radius = projectiles.radius[p];
+
+        // A jump over half the screen means the projectile wrapped this step
+        Vector2 wrapShift = { 0.0f, 0.0f };
+        if (end.x - start.x > SCREEN_WIDTH * 0.5f) wrapShift.x = (float)SCREEN_WIDTH;
+        else if (start.x - end.x > SCREEN_WIDTH * 0.5f) wrapShift.x = -(float)SCREEN_WIDTH;
+        if (end.y - start.y > SCREEN_HEIGHT * 0.5f) wrapShift.y = (float)SCREEN_HEIGHT;
+        else if (start.y - end.y > SCREEN_HEIGHT * 0.5f) wrapShift.y = -(float)SCREEN_HEIGHT;
+
+        size_t firstContact = contacts.size();
+
+        if (wrapShift.x == 0.0f && wrapShift.y == 0.0f) {
+            GatherSegmentContacts(p, start, end, radius);
         }
+        else {
+            // Travel up to the crossed edge, then from the opposite edge to the current position
+            GatherSegmentContacts(p, start, { end.x - wrapShift.x, end.y - wrapShift.y }, radius);
+            GatherSegmentContacts(p, { start.x + wrapShift.x, start.y + wrapShift.y }, end, radius);
+        }
+
+        std::sort(contacts.begin() + firstContact, contacts.end(),
+            [](const CollisionContact& a, const CollisionContact& b) {
+                if (a.time != b.time) return a.time < b.time;
+                return a.asteroidIndex < b.asteroidIndex;
+            });
+    }
+}
+
+/**
+ * Sweeps one projectile segment against the asteroids and records all hits
+ * Queries the broadphase grid with the segment's bounding box
+ * @param projectileIndex Index of the projectile being swept
+ * @param start Segment start position
+ * @param end Segment end position
+ * @param radius Projectile radius added to every asteroid radius
+ */
+void CollisionSystem::GatherSegmentContacts(int projectileIndex, Vector2 start, Vector2 end, float radius) {
+    const auto& asteroids = objectManager.GetAsteroids();
+
+    if (broadphaseEnabled) {
+        Rectangle sweptBounds = {
+            fminf(start.x, end.x) - radius,
+            fminf(start.y, end.y) - radius,
+            fabsf(end.x - start.x) + radius * 2.0f,
+            fabsf(end.y - start.y) + radius * 2.0f
+        };
+        asteroidGrid.Query(sweptBounds, candidates);
+    }
+    else {
+        candidates.clear();
+        for (int a = 0; a < asteroids.size(); a++) {
+            candidates.push_back(a);
+        }
+    }
+
+    for (int a : candidates) {
+        if (!asteroids.IsAlive(a)) continue;
+
+        Vector2 center = { asteroids.px[a], asteroids.py[a] };
+        float time;
+        if (Narrowphase::SweepSegmentCircle(start, end, center, asteroids.radius[a] + radius, time)) {
+            contacts.push_back({ projectileIndex, a, time });
+        }
+    }
+}
+
+/**
+ * Resolves the gathered contacts in list order
+ * Each projectile destroys at most one asteroid and each asteroid is destroyed
+ * at most once - later contacts involving a consumed object are skipped
+ * Awards points and queues destroys, fragments and power-up drops
+ */
+void CollisionSystem::ResolveProjectileContacts() {
+    auto& projectiles = objectManager.GetProjectilesMutable();
+    const auto& asteroids = objectManager.GetAsteroids();
+
+    for (const CollisionContact& contact : contacts) {
+        Projectile projectile = projectiles[contact.projectileIndex];
+        ConstAsteroid asteroid = asteroids[contact.asteroidIndex];
+
+        // Already used up by an earlier contact in this sweep
+        if (!projectile.IsActive() || claimedAsteroids[contact.asteroidIndex]) continue;
+
+        projectile.Deactivate();
+        claimedAsteroids[contact.asteroidIndex] = 1;
+        objectManager.DestroyAsteroid(contact.asteroidIndex);
+
+        Vector2 asteroidPos = asteroid.GetPosition();
+        AsteroidSize currentSize = asteroid.GetSize();
+
+        // Add points
+        gameScore.AddPoints(asteroid.GetPoints());
+
+        // Queue smaller asteroids with slightly offset positions to avoid overlap
+        if (currentSize == LARGE) {
+            objectManager.SpawnAsteroid({ asteroidPos.x + 20, asteroidPos.y + 20 }, MEDIUM);
+            objectManager.SpawnAsteroid({ asteroidPos.x - 20, asteroidPos.y - 20 }, MEDIUM);
+        }
+        else if (currentSize == MEDIUM) {
+            objectManager.SpawnAsteroid({ asteroidPos.x + 15, asteroidPos.y + 15 }, SMALL);
+            objectManager.SpawnAsteroid({ asteroidPos.x - 15, asteroidPos.y - 15 }, SMALL);
+        }
+        // SMALL asteroids spawn nothing
 
-        if (collisionFound) break;
+        // Power-up spawn chance (only for large asteroids)
+        RandomGenerator& random = objectManager.GetContext().GetRandom(RANDOM_POWERUPS);
+        if (currentSize == LARGE && random.Range(0, 100) < 20) { // 20% chance
+            PowerUpType randomType = static_cast<PowerUpType>(random.Range(0, 2));
+            objectManager.SpawnPowerUp(asteroidPos, randomType);
+        }
     }
 }
 
 /**
- * Checks collisions between the player spaceship and all asteroids
+ * Checks collisions between a spaceship and nearby asteroids
+ * The ship is tested as its triangle, or as the shield circle while the shield is up
  * Respects invulnerability status and handles shield protection
  * Manages life loss, shield destruction, and collision consequences
- * @param hasShield Whether the player currently has shield protection
- * @param isInvulnerable Whether the player is currently invulnerable
+ * @param player Ship to test
+ * @param isInvulnerable Whether the ship is currently invulnerable
  */
-void CollisionSystem::CheckPlayerAsteroidCollisions(bool hasShield, bool isInvulnerable) {
+void CollisionSystem::CheckShipAsteroidCollisions(Spaceship& player, bool isInvulnerable) {
     if (isInvulnerable) return; // Player is invulnerable - no collisions
 
-    Spaceship& player = objectManager.GetPlayer();
-    auto& asteroids = const_cast<std::vector<Asteroid>&>(objectManager.GetAsteroids());
+    const auto& asteroids = objectManager.GetAsteroids();
 
-    Rectangle playerBounds = player.GetBounds();
+    if (broadphaseEnabled) {
+        // Shield circle encloses the ship triangle, so it bounds both tests
+        Vector2 position = player.GetPosition();
+        float reach = player.GetShieldRadius();
+        asteroidGrid.Query({ position.x - reach, position.y - reach, reach * 2.0f, reach * 2.0f }, candidates);
+        std::sort(candidates.begin(), candidates.end());
+    }
+    else {
+        candidates.clear();
+        for (int i = 0; i < asteroids.size(); i++) {
+            candidates.push_back(i);
+        }
+    }
 
-    for (auto& asteroid : asteroids) {
-        if (!asteroid.IsActive()) continue;
+    if (player.IsShieldActive()) {
+        Narrowphase::CollectCircleHits(player.GetPosition(), player.GetShieldRadius(),
+            asteroids, candidates, hits);
+    }
+    else {
+        Narrowphase::CollectTriangleHits(player.GetTrianglePoints(), asteroids, candidates, hits);
+    }
 
-        if (CheckCollisionRecs(playerBounds, asteroid.GetBounds())) {
-            // IMMEDIATELY deactivate asteroid
-            asteroid.Destroy();
+    for (int index : hits) {
+        if (claimedAsteroids[index]) continue;
 
-            // Check if shield is active
-            if (player.IsShieldActive()) {
-                // Shield absorbs damage and gets destroyed
-                player.DeactivateShield();
-                return; // Player doesn't lose a life
-            }
+        // Queue asteroid destruction
+        claimedAsteroids[index] = 1;
+        objectManager.DestroyAsteroid(index);
 
-            // Player loses a life (only if no shield and not invulnerable)
-            player.LoseLife();
-            break; // Only one collision per frame
+        // Check if shield is active
+        if (player.IsShieldActive()) {
+            // Shield absorbs damage and gets destroyed
+            player.DeactivateShield();
+            return; // Player doesn't lose a life
         }
+
+        // Player loses a life (only if no shield and not invulnerable)
+        player.LoseLife();
+        break; // Only one collision per frame
     }
 }
\ No newline at end of file
@@ -1,10 +1,26 @@
 #ifndef COLLISIONSYSTEM_H
 #define COLLISIONSYSTEM_H
 
+#include <vector>
+#include "frameArena.h"
 #include "objectmanager.h"
 #include "score.h"
+#include "spatialGrid.h"
 #include "raylib.h"
 
+class JobSystem;
+
+/**
+ * Projectile-asteroid hit found during the collision sweep
+ * Resolved after the sweep in projectile index order, and per projectile
+ * in order of impact along its path
+ */
+struct CollisionContact {
+    int projectileIndex;    // Index into the object manager's projectile vector
+    int asteroidIndex;      // Index into the object manager's asteroid vector
+    float time;             // Fraction of the projectile's last step at which it hit (0..1)
+};
+
 /**
  * CollisionSystem class handles all collision detection and response in the game
  * Manages interactions between projectiles, asteroids, and the player spaceship
@@ -14,13 +30,54 @@ class CollisionSystem {
 private:
     ObjectManager& objectManager;  // Reference to object manager for accessing game objects
     Score& gameScore;             // Reference to score system for awarding points
+    SpatialGrid asteroidGrid;     // Broadphase grid rebuilt from the asteroid vector each frame
+    std::vector<int> candidates;  // Reusable broadphase query result buffer
+    ArenaVector<CollisionContact> contacts;   // Projectile-asteroid overlaps of the current sweep (frame arena)
+    std::vector<int> hits;        // Reusable narrowphase result buffer
+    ArenaVector<unsigned char> claimedAsteroids; // Asteroids whose destruction is already queued this frame (frame arena)
+    bool broadphaseEnabled;       // Whether checks query the grid instead of walking every asteroid
+    std::vector<Rectangle> asteroidBounds;    // Bounds per asteroid index for the grid rebuild
+    JobSystem* jobs;              // Pool for the grid rebuild (nullptr = serial)
+    FrameArena* frameArena;       // Arena for per-sweep lists (nullptr = heap)
+    static const int RESERVED_ASTEROIDS = 256;  // Asteroids the grid buffers are sized for up front
 
     void CheckProjectileAsteroidCollisions();
-    void CheckPlayerAsteroidCollisions(bool hasShield, bool isInvulnerable);
+    void GatherProjectileContacts();
+    void GatherSegmentContacts(int projectileIndex /* Projectile being swept */,
+        Vector2 start /* Segment start position */,
+        Vector2 end /* Segment end position */,
+        float radius /* Projectile radius */);
+    void ResolveProjectileContacts();
+    void CheckShipAsteroidCollisions(Spaceship& player /* Ship to test */,
+        bool isInvulnerable /* Whether the ship is currently invulnerable */);
+    void BeginSweep();
 
 public:
       CollisionSystem(ObjectManager& objMgr, Score& score);
     void CheckCollisions(bool hasShield, bool isInvulnerable);
+    void CheckCollisions(Spaceship* ships /* Ships of a multi-ship session */,
+        int shipCount /* Number of ships */);
+    void BuildAsteroidGrid();
+    SpatialGrid& GetAsteroidGrid() {
+        return asteroidGrid;
+    }
+
+    // Only pays off for fields of many PARALLEL_GRAIN entities (--bench-parallel);
+    // game sessions stay serial
+    void SetJobSystem(JobSystem* jobSystem /* Pool for the grid rebuild, or nullptr for serial */) {
+        jobs = jobSystem;
+    }
+    void SetFrameArena(FrameArena* arena /* Arena reset after every step, or nullptr for the heap */) {
+        frameArena = arena;
+    }
+
+    // Broadphase toggle (brute force is kept as a reference path for benchmarks)
+    void SetBroadphaseEnabled(bool enabled) {
+        broadphaseEnabled = enabled;
+    }
+    bool IsBroadphaseEnabled() const {
+        return broadphaseEnabled;
+    }
 };
 
 #endif
\ No newline at end of file
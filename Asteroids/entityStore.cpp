@@ -0,0 +1,99 @@
+#include "entityStore.h"
+#include "globals.h"
+#include <cmath>
+
+/**
+ * Appends a zero-initialized slot to every hot array
+ * New slots start dead (lifetime 0) until the owner spawns them
+ * @return Index of the new slot
+ */
+int EntityStore::AddHot() {
+    px.push_back(0.0f);
+    py.push_back(0.0f);
+    vx.push_back(0.0f);
+    vy.push_back(0.0f);
+    radius.push_back(0.0f);
+    lifetime.push_back(0.0f);
+    prevPx.push_back(0.0f);
+    prevPy.push_back(0.0f);
+    return size() - 1;
+}
+
+/**
+ * Copies all hot fields of one slot into another
+ * Used by compaction to close the gaps left by dead entities
+ * @param from Source slot index
+ * @param to Destination slot index
+ */
+void EntityStore::MoveHot(int from, int to) {
+    px[to] = px[from];
+    py[to] = py[from];
+    vx[to] = vx[from];
+    vy[to] = vy[from];
+    radius[to] = radius[from];
+    lifetime[to] = lifetime[from];
+    prevPx[to] = prevPx[from];
+    prevPy[to] = prevPy[from];
+}
+
+/**
+ * Resizes every hot array to the given slot count
+ * Shrinking keeps capacity, so later growth does not hit the heap
+ * @param count New number of slots
+ */
+void EntityStore::ResizeHot(int count) {
+    px.resize(count);
+    py.resize(count);
+    vx.resize(count);
+    vy.resize(count);
+    radius.resize(count);
+    lifetime.resize(count);
+    prevPx.resize(count);
+    prevPy.resize(count);
+}
+
+/**
+ * Reserves capacity in every hot array
+ * @param capacity Number of slots to reserve
+ */
+void EntityStore::ReserveHot(int capacity) {
+    px.reserve(capacity);
+    py.reserve(capacity);
+    vx.reserve(capacity);
+    vy.reserve(capacity);
+    radius.reserve(capacity);
+    lifetime.reserve(capacity);
+    prevPx.reserve(capacity);
+    prevPy.reserve(capacity);
+}
+
+/**
+ * Copies the current positions of a slot range into the previous-position arrays
+ * Called at the start of every integration step
+ * @param first First slot to copy
+ * @param last One past the last slot to copy
+ */
+void EntityStore::SavePreviousPositions(int first, int last) {
+    for (int i = first; i < last; i++) {
+        prevPx[i] = px[i];
+        prevPy[i] = py[i];
+    }
+}
+
+/**
+ * Blends the previous and current position of a slot for rendering
+ * Entities that wrapped around the screen during the last step are drawn
+ * at their current position instead of sliding across the whole screen
+ * @param index Slot index
+ * @param alpha Blend factor, 0 = previous step, 1 = current step
+ * @return Interpolated render position
+ */
+Vector2 EntityStore::GetRenderPosition(int index, float alpha) const {
+    float dx = px[index] - prevPx[index];
+    float dy = py[index] - prevPy[index];
+
+    if (fabsf(dx) > SCREEN_WIDTH * 0.5f || fabsf(dy) > SCREEN_HEIGHT * 0.5f) {
+        return { px[index], py[index] };
+    }
+    return { prevPx[index] + dx * alpha, prevPy[index] + dy * alpha };
+}
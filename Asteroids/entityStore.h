@@ -0,0 +1,47 @@
+#ifndef ENTITYSTORE_H
+#define ENTITYSTORE_H
+
+#include <vector>
+#include "raylib.h"
+
+/**
+ * EntityStore class holding the hot simulation data of one entity type
+ * Uses structure-of-arrays layout: every field lives in its own contiguous array,
+ * so integration loops only stream the data they actually touch
+ * Slot i of every array belongs to the same entity; the array size is the live count
+ */
+class EntityStore {
+public:
+    std::vector<float> px;          // Position x coordinates in pixels
+    std::vector<float> py;          // Position y coordinates in pixels
+    std::vector<float> vx;          // Velocity x components in pixels per second
+    std::vector<float> vy;          // Velocity y components in pixels per second
+    std::vector<float> radius;      // Collision radius in pixels (also the wrap margin)
+    std::vector<float> lifetime;    // Remaining lifetime in seconds, entity is dead at <= 0
+    std::vector<float> prevPx;      // Position x before the last simulation step (render interpolation)
+    std::vector<float> prevPy;      // Position y before the last simulation step (render interpolation)
+
+    int size() const {
+        return static_cast<int>(px.size());
+    }
+    bool empty() const {
+        return px.empty();
+    }
+    int Capacity() const {
+        return static_cast<int>(px.capacity());
+    }
+    bool IsAlive(int index /* Slot index */) const {
+        return lifetime[index] > 0.0f;
+    }
+    Vector2 GetRenderPosition(int index /* Slot index */,
+        float alpha /* Blend factor between previous (0) and current (1) position */) const;
+
+protected:
+    int AddHot();
+    void MoveHot(int from /* Source slot */, int to /* Destination slot */);
+    void ResizeHot(int count /* New slot count */);
+    void ReserveHot(int capacity /* Slot count to reserve */);
+    void SavePreviousPositions(int first /* First slot */, int last /* One past the last slot */);
+};
+
+#endif
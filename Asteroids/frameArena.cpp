@@ -0,0 +1,172 @@
+#include "frameArena.h"
+#include <atomic>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+/**
+ * Rounds a size up to a multiple of a power-of-two alignment
+ */
+static size_t AlignUp(size_t value, size_t alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+/**
+ * Constructor for FrameArena class
+ * @param bytes Initial block size
+ */
+FrameArena::FrameArena(size_t bytes) :
+    buffer(new unsigned char[bytes]),
+    capacity(bytes),
+    used(0),
+    peak(0),
+    overflowBytes(0),
+    overflowBlocks(nullptr) {
+}
+
+/**
+ * Destructor for FrameArena class
+ * Frees the heap blocks of an unfinished frame
+ */
+FrameArena::~FrameArena() {
+    Reset();
+}
+
+/**
+ * Hands out memory that stays valid until the next Reset()
+ * Takes the next aligned range of the block; once the block is full the
+ * request goes to the heap and is freed by Reset()
+ * @param size Bytes to allocate
+ * @param alignment Power of two
+ * @return Uninitialized memory
+ */
+void* FrameArena::Allocate(size_t size, size_t alignment) {
+    uintptr_t base = reinterpret_cast<uintptr_t>(buffer.get());
+    size_t offset = AlignUp(base + used, alignment) - base;
+    if (offset + size <= capacity) {
+        used = offset + size;
+        return buffer.get() + offset;
+    }
+
+    // Overflow: one heap block per request, the header keeps the chain
+    size_t header = AlignUp(sizeof(void*), alignment);
+    unsigned char* block = static_cast<unsigned char*>(::operator new(header + size));
+    *reinterpret_cast<void**>(block) = overflowBlocks;
+    overflowBlocks = block;
+    overflowBytes += size + alignment;
+    return block + header;
+}
+
+/**
+ * Formats a string into the arena, like TextFormat() without its shared
+ * ring of static buffers
+ * @param format printf format
+ * @return Formatted string, valid until the next Reset()
+ */
+const char* FrameArena::Format(const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    va_list sizing;
+    va_copy(sizing, args);
+    int length = vsnprintf(nullptr, 0, format, sizing);
+    va_end(sizing);
+
+    if (length < 0) {
+        va_end(args);
+        return "";
+    }
+    char* text = AllocateArray<char>((size_t)length + 1);
+    vsnprintf(text, (size_t)length + 1, format, args);
+    va_end(args);
+    return text;
+}
+
+/**
+ * Releases everything allocated this frame
+ * If the frame overflowed, the heap blocks are freed and the block grows
+ * to the frame's total, so the next frame like it fits
+ */
+void FrameArena::Reset() {
+    size_t frameBytes = used + overflowBytes;
+    if (frameBytes > peak) peak = frameBytes;
+
+    while (overflowBlocks) {
+        void* next = *static_cast<void**>(overflowBlocks);
+        ::operator delete(overflowBlocks);
+        overflowBlocks = next;
+    }
+
+    if (overflowBytes > 0) {
+        capacity = AlignUp(frameBytes + frameBytes / 2, alignof(std::max_align_t));
+        buffer.reset(new unsigned char[capacity]);
+    }
+    used = 0;
+    overflowBytes = 0;
+}
+
+#if ENABLE_ALLOCATION_COUNTER
+
+// Calls of the replaced operator new, per thread and in total
+static thread_local uint64_t threadAllocations = 0;
+static std::atomic<uint64_t> totalAllocations(0);
+
+namespace AllocationCounter {
+
+    /**
+     * Gets the heap allocations made by the calling thread so far
+     * @return Number of operator new calls
+     */
+    uint64_t GetThreadCount() {
+        return threadAllocations;
+    }
+
+    /**
+     * Gets the heap allocations made by all threads so far
+     * @return Number of operator new calls
+     */
+    uint64_t GetTotalCount() {
+        return totalAllocations.load(std::memory_order_relaxed);
+    }
+}
+
+// Replaced global allocation functions; the array and nothrow forms forward
+// to these. Over-aligned allocations keep the standard library's versions
+void* operator new(std::size_t size) {
+    threadAllocations++;
+    totalAllocations.fetch_add(1, std::memory_order_relaxed);
+    void* pointer = std::malloc(size ? size : 1);
+    if (!pointer) throw std::bad_alloc();
+    return pointer;
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+
+#else
+
+namespace AllocationCounter {
+
+    /**
+     * Counter compiled out: no allocations are counted
+     * @return Always 0
+     */
+    uint64_t GetThreadCount() {
+        return 0;
+    }
+
+    /**
+     * Counter compiled out: no allocations are counted
+     * @return Always 0
+     */
+    uint64_t GetTotalCount() {
+        return 0;
+    }
+}
+
+#endif
@@ -0,0 +1,111 @@
+#ifndef FRAMEARENA_H
+#define FRAMEARENA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+// Set to 1 to replace the global operator new/delete with counting versions
+// Only the headless project enables it; every allocation then pays for an
+// atomic increment on a shared counter
+#ifndef ENABLE_ALLOCATION_COUNTER
+#define ENABLE_ALLOCATION_COUNTER 0
+#endif
+
+#define FRAME_ARENA_SIZE (64 * 1024)    // Default bytes of a frame arena
+
+/**
+ * FrameArena class handing out memory for data that lives one frame
+ * Allocation bumps a pointer through one preallocated block; nothing is
+ * freed individually, Reset() releases everything at once at the end of
+ * the frame. A frame that runs out of space falls back to the heap and
+ * the block grows at the next Reset(), so a steady frame stops allocating
+ * Not synchronized - every thread uses its own arena
+ */
+class FrameArena {
+private:
+    std::unique_ptr<unsigned char[]> buffer;    // Block the arena bumps through
+    size_t capacity;                            // Size of the block in bytes
+    size_t used;                                // Bytes handed out this frame
+    size_t peak;                                // Most bytes a frame needed, incl. overflow
+    size_t overflowBytes;                       // Bytes this frame took from the heap
+    void* overflowBlocks;                       // Heap blocks of this frame, linked through their first word
+
+public:
+    explicit FrameArena(size_t bytes = FRAME_ARENA_SIZE /* Initial block size */);
+    ~FrameArena();
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    void* Allocate(size_t size /* Bytes to allocate */,
+        size_t alignment = alignof(std::max_align_t) /* Power of two */);
+    template <typename T>
+    T* AllocateArray(size_t count /* Elements to allocate (left uninitialized) */) {
+        return static_cast<T*>(Allocate(count * sizeof(T), alignof(T)));
+    }
+    const char* Format(const char* format /* printf format */, ...);
+    void Reset();
+
+    size_t GetCapacity() const { return capacity; }
+    size_t GetUsed() const { return used + overflowBytes; }
+    size_t GetPeak() const { return peak; }
+};
+
+/**
+ * STL allocator adapter drawing from a FrameArena
+ * Containers using it must not outlive the arena's next Reset(); without
+ * an arena it falls back to the heap. Deallocation into an arena is a
+ * no-op, the memory comes back at Reset()
+ */
+template <typename T>
+class ArenaAllocator {
+public:
+    typedef T value_type;
+    typedef std::true_type propagate_on_container_copy_assignment;
+    typedef std::true_type propagate_on_container_move_assignment;
+    typedef std::true_type propagate_on_container_swap;
+
+    FrameArena* arena;      // Arena to draw from (nullptr = heap)
+
+    ArenaAllocator(FrameArena* frameArena = nullptr /* Arena to draw from, nullptr for the heap */) noexcept :
+        arena(frameArena) {
+    }
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other /* Allocator to rebind */) noexcept :
+        arena(other.arena) {
+    }
+
+    T* allocate(size_t count) {
+        if (arena) return arena->AllocateArray<T>(count);
+        return static_cast<T*>(::operator new(count * sizeof(T)));
+    }
+    void deallocate(T* pointer, size_t) noexcept {
+        if (!arena) ::operator delete(pointer);
+    }
+};
+
+template <typename T, typename U>
+bool operator==(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) {
+    return a.arena == b.arena;
+}
+
+template <typename T, typename U>
+bool operator!=(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) {
+    return a.arena != b.arena;
+}
+
+// Vector whose storage comes from a frame arena
+template <typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+// Counts of global operator new calls (ENABLE_ALLOCATION_COUNTER)
+// Used to prove that a steady frame does not touch the heap; always 0
+// when the counter is compiled out
+namespace AllocationCounter {
+    uint64_t GetThreadCount();
+    uint64_t GetTotalCount();
+}
+
+#endif
@@ -1,74 +1,286 @@
 ﻿#include "game.h"
 #include "globals.h"
 #include "highscoreManager.h"
+#include "profiler.h"
+#include "random.h"
+#include "worldChecksum.h"
+#include <chrono>
+#include <ctime>
 #include <iostream>
+#include <cmath>
 
 /**
  * Constructor for the Game class
  * Initializes all game components, systems, and dependencies
  * Sets up audio system and connects UI renderer with highscore manager
+ * Enables profiling on the constructing thread and names its track in
+ * trace files
+ * @param runHeadless Skip the audio device; Initialize will not open a window
  */
-Game::Game() :
+Game::Game(bool runHeadless) :
     projectileCooldown(0),
     asteroidSpawnTimer(0),
     currentItem(0),
     amountRapid(0),
     hasRapid(false),
     hasShield(false),
-    stateManager(),
+    shootSound(),
+    backgroundMusic(),
+    headless(runHeadless),
+    stepAccumulator(0.0f),
+    maxStepsPerFrame(MAX_STEPS_PER_FRAME),
+    tracedSpawnCount(0),
+    replayMode(REPLAY_OFF),
+    replayRestoreSource(nullptr),
+    replayVerified(false),
+    simulationThreaded(false),
+    tickAllocations(0),
+    shotsFired(0),
+    highscoreRevision(0),
+    playedShots(0),
+    savedHighscoreRevision(0),
+    context(),
     player(),
-    gameScore(),
-    objectManager(player),
+    gameScore(context.GetScore()),
+    stateManager(context.GetStateManager()),
+    objectManager(&player, 1, context),
     collisionSystem(objectManager, gameScore),
     inputHandler(*this, stateManager, objectManager, projectileCooldown,
         currentItem, hasRapid, amountRapid, hasShield),
-    uiRenderer(stateManager, gameScore, player, objectManager, currentItem) {
-    InitGameSounds();
-    uiRenderer.SetHighscoreManager(&highscoreManager);
+    uiRenderer() {
+    collisionSystem.SetFrameArena(&simulationArena);
+    uiRenderer.SetFrameArena(&drawArena);
+    Profiler::SetThreadEnabled(true);
+    Trace::SetThreadName("Main");
+    if (!headless) {
+        InitGameSounds();
+    }
 }
 
 /**
  * Destructor for the Game class
  * Saves the high score and unloads all audio resources
+ * Headless runs leave the high score file untouched
+ * Finishes a running trace file so it stays valid JSON
+ * A session still being recorded is saved as far as it was played
+ * Stops the simulation thread first, so nothing else touches the game
  */
 Game::~Game() {
-    gameScore.SaveHighScore();
-    UnloadGameSounds();
+    StopSimulationThread();
+    Trace::Stop();
+    if (replayMode == REPLAY_RECORDING) {
+        FinishRecording();
+    }
+    if (!headless) {
+        gameScore.SaveHighScore();
+        UnloadGameSounds();
+    }
 }
 
 /**
  * Initializes the game window and core game settings
  * Sets up the game window, target framerate, and spawns initial asteroids
+ * Windowed games seed the random streams from the clock; headless games
+ * skip the window and keep the seed their runner chose
  */
 void Game::Initialize() {
     gameRunning = true;
-    InitWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "Asteroids");
-    SetTargetFPS(60);
+    if (!headless) {
+        InitWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "Asteroids");
+        SetTargetFPS(60);
+        SeedRandom((unsigned int)time(nullptr));
+    }
     objectManager.SpawnAsteroids(4);
+    objectManager.ApplyPendingCommands();
+    PublishSnapshot();
 }
 
 /**
  * Main game update loop
- * Updates background music, handles input, and updates game state
- * Calls specific update methods based on current game state
+ * Updates background music and advances the simulation in fixed steps
+ * While the simulation runs on its own thread, only the keyboard is read
+ * here and handed to that thread
+ * F3 toggles the profiler overlay, F4 starts and stops writing trace.json
  */
 void Game::Update() {
-    float deltaTime = GetFrameTime();
+    PROFILE_SCOPE(ZONE_UPDATE);
 
     // Update background music
-    UpdateMusicStream(backgroundMusic);
+    if (!headless) {
+        UpdateMusicStream(backgroundMusic);
+
+        // Debug overlay toggle, independent of the simulated input
+        if (IsKeyPressed(KEY_F3)) {
+            Profiler::ToggleOverlay();
+        }
+        if (IsKeyPressed(KEY_F4)) {
+            if (Trace::IsActive()) Trace::Stop();
+            else Trace::Start("trace.json");
+        }
+    }
+
+    if (simulationThreaded) {
+        inputHandler.CaptureKeyboard();
+    }
+    else {
+        AdvanceSimulation(GetFrameTime());
+    }
+}
+
+/**
+ * Runs the fixed steps a frame's worth of time calls for
+ * The frame time is accumulated and consumed in FIXED_TIME_STEP slices, so
+ * physics does not depend on the frame rate; at most maxStepsPerFrame steps
+ * run per frame and any remaining backlog is dropped after a hitch
+ * Publishes a render snapshot with the leftover fraction of a step for interpolation
+ * @param frameTime Time to catch up on in seconds
+ */
+void Game::AdvanceSimulation(float frameTime) {
+    inputHandler.BeginFrame();
+    stepAccumulator += frameTime;
+
+    int steps = 0;
+    while (stepAccumulator >= FIXED_TIME_STEP && steps < maxStepsPerFrame) {
+        Tick(FIXED_TIME_STEP);
+        stepAccumulator -= FIXED_TIME_STEP;
+        steps++;
+    }
+
+    // Spiral-of-death guard: drop simulation time the frame could not catch up on
+    if (stepAccumulator >= FIXED_TIME_STEP) {
+        stepAccumulator = fmodf(stepAccumulator, FIXED_TIME_STEP);
+    }
+
+    PublishSnapshot();
+}
 
+/**
+ * Copies the state the renderer needs into the next snapshot slot and publishes it
+ * Runs on whichever thread steps the simulation
+ */
+void Game::PublishSnapshot() {
+    RenderSnapshot& snapshot = snapshots.BeginWrite();
+    snapshot.stateManager = stateManager;
+    snapshot.score = gameScore;
+    snapshot.player = player;
+    snapshot.currentItem = currentItem;
+    snapshot.asteroids = objectManager.GetAsteroids();
+    snapshot.projectiles = objectManager.GetProjectiles();
+    snapshot.powerups = objectManager.GetPowerUps();
+    snapshot.projectileStats = objectManager.GetProjectileStats();
+    snapshot.asteroidStats = objectManager.GetAsteroidStats();
+    snapshot.powerupStats = objectManager.GetPowerUpStats();
+    snapshot.highscores = highscoreManager.GetHighscores();
+    snapshot.shotsFired = shotsFired;
+    snapshot.highscoreRevision = highscoreRevision;
+    snapshot.stepRemainder = stepAccumulator;
+    snapshot.tickAllocations = tickAllocations;
+    snapshot.publishTime = std::chrono::steady_clock::now();
+    snapshots.Publish();
+}
+
+/**
+ * Moves the simulation to its own thread
+ * From then on the simulation ticks at its own rate, independent of the
+ * render rate, and Draw() only reads the published snapshots
+ * The session's SimulationContext moves with it; the calling thread only
+ * reads published snapshots afterwards
+ * Call after Initialize() and any replay setup
+ */
+void Game::StartSimulationThread() {
+    if (simulationThreaded || headless) return;
+
+    inputHandler.SetExternalKeyboardCapture(true);
+    simulationThreaded = true;
+    simulationThread = std::thread(&Game::SimulationLoop, this);
+}
+
+/**
+ * Stops the simulation thread and returns the simulation to Update()
+ */
+void Game::StopSimulationThread() {
+    if (!simulationThreaded) return;
+
+    simulationThreaded = false;
+    simulationThread.join();
+    inputHandler.SetExternalKeyboardCapture(false);
+}
+
+/**
+ * Body of the simulation thread
+ * Catches up on the time since the previous pass, then sleeps until the
+ * next fixed step is due
+ */
+void Game::SimulationLoop() {
+    Profiler::SetThreadEnabled(true);
+    Trace::SetThreadName("Simulation");
+    auto previous = std::chrono::steady_clock::now();
+
+    while (simulationThreaded && gameRunning) {
+        auto now = std::chrono::steady_clock::now();
+        try {
+            AdvanceSimulation(std::chrono::duration<float>(now - previous).count());
+        }
+        catch (const std::exception& e) {
+            std::cerr << "Error in simulation thread: " << e.what() << std::endl;
+        }
+        previous = now;
+
+        float untilNextStep = FIXED_TIME_STEP - stepAccumulator;
+        std::this_thread::sleep_until(now + std::chrono::duration<float>(untilNextStep));
+    }
+}
+
+/**
+ * Advances the game by one time step
+ * Handles input and updates the game state without touching window or audio,
+ * so the headless target can drive it with a fixed time step
+ * Calls specific update methods based on current game state
+ * Samples the trace counters after the step while a trace is being written
+ * and ends a recording or playback once its session is over
+ * Releases the step's frame arena and counts the heap allocations it made
+ * @param deltaTime Time step in seconds
+ */
+void Game::Tick(float deltaTime) {
+    PROFILE_SCOPE(ZONE_TICK);
+    uint64_t allocationsBefore = AllocationCounter::GetThreadCount();
+
+    player.SavePreviousState();
     inputHandler.HandleInput(deltaTime);
     stateManager.Update(deltaTime);
 
     if (stateManager.GetCurrentState() == IN_GAME) {
         UpdateInGame(deltaTime);
     }
+
+    if (Trace::IsActive()) {
+        TraceCounters();
+    }
+    if (replayMode != REPLAY_OFF) {
+        UpdateReplay();
+    }
+
+    simulationArena.Reset();
+    tickAllocations = AllocationCounter::GetThreadCount() - allocationsBefore;
+}
+
+/**
+ * Samples entity counts and spawns of the last tick into the trace file
+ */
+void Game::TraceCounters() {
+    int spawnCount = objectManager.GetSpawnCount();
+    Trace::Counter("Asteroids", objectManager.GetAsteroidStats().live);
+    Trace::Counter("Projectiles", objectManager.GetProjectileStats().live);
+    Trace::Counter("PowerUps", objectManager.GetPowerUpStats().live);
+    Trace::Counter("Spawns", spawnCount - tracedSpawnCount);
+    tracedSpawnCount = spawnCount;
 }
 
 /**
  * Updates all in-game logic during active gameplay
  * Handles player updates, object management, collision detection, and spawning
+ * Spawns and destroys queued during update and collision are applied at a
+ * single sync point before the game state is evaluated
  */
 void Game::UpdateInGame(float deltaTime) {
     player.Update(deltaTime);
@@ -79,6 +291,10 @@ void Game::UpdateInGame(float deltaTime) {
 
     collisionSystem.CheckCollisions(hasShield, isInvulnerable);
     HandleSpawning(deltaTime);
+
+    // Sync point - no object vector is being iterated here
+    objectManager.ApplyPendingCommands();
+
     CheckGameState();
     CheckPowerUpCollisions();
 }
@@ -86,62 +302,62 @@ void Game::UpdateInGame(float deltaTime) {
 /**
  * Checks for collisions between the player and power-ups
  * Handles power-up collection and applies their effects
+ * The pickup test is shared with multiplayer sessions (ObjectManager::CollectPowerUp)
  */
 void Game::CheckPowerUpCollisions() {
-    Rectangle playerBounds = player.GetBounds();
-
-       // Check all power-ups
-    auto& powerups = const_cast<std::vector<PowerUp>&>(objectManager.GetPowerUps());
-
-    for (auto& powerup : powerups) {
-        if (powerup.IsActive()) {
-            Rectangle powerupBounds = powerup.GetBounds();
-
-            if (CheckCollisionRecs(playerBounds, powerupBounds)) {
-                printf("COLLISION DETECTED! PowerUp Type: %d\n", (int)powerup.GetType());
-
-                // Collect power-up
-                PowerUpType type = powerup.GetType();
-                powerup.Collect(); // Deactivate power-up
-
-                // Set item based on type
-                switch (type) {
-                case EXTRA_LIFE:
-                    printf("Collected EXTRA_LIFE - adding life immediately\n");
-                    player.AddLife();
-                    currentItem = 0; // Use immediately, don't store
-                    break;
-
-                case RAPID_FIRE:
-                    printf("Collected RAPID_FIRE - stored as item\n");
-                    currentItem = 1; // Store as item
-                    break;
-
-                case SHIELD:
-                    printf("Collected SHIELD - stored as item\n");
-                    currentItem = 2; // Store as item
-                    break;
-
-                default:
-                    printf("Unknown PowerUp type: %d\n", (int)type);
-                    break;
-                }
-
-                printf("currentItem is now: %d\n", currentItem);
-                break; // Only collect one power-up per frame
-            }
-        }
+    PowerUpType type;
+    if (!objectManager.CollectPowerUp(0, type)) return; // Only collect one power-up per frame
+
+    printf("COLLISION DETECTED! PowerUp Type: %d\n", (int)type);
+
+    // Set item based on type
+    switch (type) {
+    case EXTRA_LIFE:
+        printf("Collected EXTRA_LIFE - adding life immediately\n");
+        player.AddLife();
+        currentItem = 0; // Use immediately, don't store
+        break;
+
+    case RAPID_FIRE:
+        printf("Collected RAPID_FIRE - stored as item\n");
+        currentItem = 1; // Store as item
+        break;
+
+    case SHIELD:
+        printf("Collected SHIELD - stored as item\n");
+        currentItem = 2; // Store as item
+        break;
+
+    default:
+        printf("Unknown PowerUp type: %d\n", (int)type);
+        break;
     }
+
+    printf("currentItem is now: %d\n", currentItem);
 }
 
 /**
  * Main drawing method for the game
- * Begins drawing context, renders current game state, and ends drawing
+ * Begins drawing context, renders the newest render snapshot, and ends drawing
+ * Never waits for the simulation; a frame without a new snapshot redraws
+ * the previous one further along its interpolation
+ * Closes the profiler frame once the frame has been presented and releases
+ * the frame's arena; the heap allocations of the frame are shown by the
+ * profiler overlay of the next one
  */
 void Game::Draw() {
+    uint64_t allocationsBefore = AllocationCounter::GetThreadCount();
+    const RenderSnapshot& snapshot = snapshots.Acquire();
+    HandleSimulationEvents(snapshot);
+    uiRenderer.SetInterpolationAlpha(snapshot.GetInterpolationAlpha(std::chrono::steady_clock::now()));
+
     BeginDrawing();
-    uiRenderer.DrawCurrentState();
+    uiRenderer.DrawCurrentState(snapshot);
     EndDrawing();
+    Profiler::EndFrame();
+
+    drawArena.Reset();
+    uiRenderer.SetDrawAllocations(AllocationCounter::GetThreadCount() - allocationsBefore);
 }
 
 /**
@@ -170,12 +386,32 @@ void Game::UnloadGameSounds() {
 }
 
 /**
- * Plays the shooting sound effect
- * Checks if sound is properly loaded before attempting to play
+ * Records a shot for the shooting sound effect
+ * Runs on the simulation thread; the sound itself is played by Draw() on
+ * the window thread, which owns the audio device
+ */
+void Game::QueueShootSound() {
+    shotsFired++;
+}
+
+/**
+ * Carries out the side effects the simulation left in a snapshot
+ * Plays the shooting sound for new shots and saves the high score table
+ * when it changed, so audio and file I/O stay on the window thread
+ * The counters only grow, so snapshots the reader skipped lose nothing;
+ * several shots within one frame play the sound once
+ * @param snapshot Snapshot just acquired by Draw()
  */
-void Game::PlayShootSound() {
-    if (shootSound.frameCount > 0) {
-        PlaySound(shootSound);
+void Game::HandleSimulationEvents(const RenderSnapshot& snapshot) {
+    if (snapshot.shotsFired != playedShots) {
+        playedShots = snapshot.shotsFired;
+        if (shootSound.frameCount > 0) {
+            PlaySound(shootSound);
+        }
+    }
+    if (snapshot.highscoreRevision != savedHighscoreRevision) {
+        savedHighscoreRevision = snapshot.highscoreRevision;
+        HighscoreManager::WriteHighscores(snapshot.highscores);
     }
 }
 
@@ -194,10 +430,7 @@ void Game::UpdateTimers(float deltaTime) {
  * Spawns new asteroids at random edge positions when timer expires
  */
 void Game::HandleSpawning(float deltaTime) {
-    float baseSpawnTime = 10.0f;
-    float minSpawnTime = 3.0f;
-    float scoreReduction = gameScore.GetScore() / 1000.0f;
-    float currentSpawnTime = SafeMax(minSpawnTime, baseSpawnTime - scoreReduction);
+    float currentSpawnTime = context.GetEdgeSpawnInterval();
 
     if (asteroidSpawnTimer > currentSpawnTime) {
         objectManager.SpawnAsteroid(objectManager.GetRandomEdgePosition(), LARGE);
@@ -211,21 +444,11 @@ void Game::HandleSpawning(float deltaTime) {
  * Triggers game over sequence when player runs out of lives
  */
 void Game::CheckGameState() {
-    bool asteroidsActive = false;
-    for (const auto& asteroid : objectManager.GetAsteroids()) {
-        if (asteroid.IsActive()) {
-            asteroidsActive = true;
-            break;
-        }
-    }
+    // Destroyed asteroids were compacted away at the sync point
+    bool asteroidsActive = !objectManager.GetAsteroids().empty();
 
     if (!asteroidsActive) {
-        int baseAsteroids = 4;
-        int bonusAsteroids = gameScore.GetScore() / 2000;
-        int maxAsteroids = 10;
-        int asteroidsToSpawn = (int)SafeMin((float)maxAsteroids, (float)(baseAsteroids + bonusAsteroids));
-
-        objectManager.SpawnAsteroids(asteroidsToSpawn);
+        objectManager.SpawnAsteroids(context.GetWaveSize());
     }
 
     if (player.GetLives() <= 0) {
@@ -259,9 +482,12 @@ void Game::HandleGameOver() {
 /**
  * Adds a new highscore entry to the highscore manager
  * Called when player enters their name for a new highscore
+ * The table is written to disk by Draw() on the window thread once the
+ * snapshot carrying the entry arrives
  */
 void Game::AddHighscoreEntry(const std::string& name, int score) {
     highscoreManager.AddHighscore(name, score);
+    highscoreRevision++;
 }
 
 /**
@@ -279,7 +505,173 @@ void Game::ResetGame() {
     hasShield = false;
     currentItem = 0;
     objectManager.SpawnAsteroids(4);
+    objectManager.ApplyPendingCommands();
+    stepAccumulator = 0.0f;
 
     // Reset name entry
     stateManager.ResetNameEntry();
-}
\ No newline at end of file
+}
+
+/**
+ * Resets the game and switches to active gameplay
+ * Used by the main menu and by the headless runner between sessions
+ */
+void Game::StartNewGame() {
+    ResetGame();
+    stateManager.SetState(IN_GAME);
+}
+/**
+ * Seeds every random stream from one session seed
+ * @param seed Seed for all simulation random numbers
+ */
+void Game::SeedRandom(unsigned int seed) {
+    context.Seed(seed);
+}
+
+/**
+ * Starts a new game whose input is recorded to a replay file
+ * The current input source keeps driving the game; the file is written
+ * when the session leaves gameplay (game over) or the game is closed
+ * @param path Replay file written when the session ends
+ * @param seed Random seed of the session
+ * @return False if a recording or playback is already running
+ */
+bool Game::StartRecordedGame(const char* path, unsigned int seed) {
+    if (replayMode != REPLAY_OFF) return false;
+
+    replayPath = path;
+    replayRestoreSource = inputHandler.GetInputSource();
+    replayRecorder.Begin(replayRestoreSource);
+    inputHandler.SetInputSource(&replayRecorder);
+    replayMode = REPLAY_RECORDING;
+
+    SeedRandom(seed);
+    StartNewGame();
+    return true;
+}
+
+/**
+ * Starts a new game driven by a replay file
+ * The game is seeded from the file header, so the recorded session is
+ * reproduced tick for tick
+ * @param path Replay file to play back
+ * @return False if the file cannot be loaded or a replay is already running
+ */
+bool Game::StartReplay(const char* path) {
+    if (replayMode != REPLAY_OFF) return false;
+    if (!replayPlayer.Load(path)) return false;
+
+    replayRestoreSource = inputHandler.GetInputSource();
+    inputHandler.SetInputSource(&replayPlayer);
+    replayMode = REPLAY_PLAYING;
+    replayVerified = false;
+
+    SeedRandom(replayPlayer.GetHeader().seed);
+    StartNewGame();
+    return true;
+}
+
+/**
+ * Ends a recording when its session left gameplay, or a playback when all
+ * recorded ticks have been played; a finished playback is compared against
+ * the score and state checksum stored in the file
+ */
+void Game::UpdateReplay() {
+    if (replayMode == REPLAY_RECORDING) {
+        if (stateManager.GetCurrentState() != IN_GAME) {
+            FinishRecording();
+        }
+        return;
+    }
+
+    if (!replayPlayer.IsFinished()) return;
+
+    const ReplayHeader& header = replayPlayer.GetHeader();
+    uint32_t checksum = ComputeStateChecksum();
+    replayVerified = gameScore.GetScore() == header.finalScore && checksum == header.finalChecksum;
+    printf("Replay finished after %u ticks: score %d (recorded %d), checksum %08x (recorded %08x) - %s\n",
+        header.tickCount, gameScore.GetScore(), header.finalScore, checksum, header.finalChecksum,
+        replayVerified ? "MATCH" : "MISMATCH");
+
+    inputHandler.SetInputSource(replayRestoreSource);
+    replayMode = REPLAY_OFF;
+}
+
+/**
+ * Writes the running recording to its replay file and returns to live input
+ */
+void Game::FinishRecording() {
+    uint32_t checksum = ComputeStateChecksum();
+    if (replayRecorder.Save(replayPath.c_str(), context.GetSeed(), gameScore.GetScore(), checksum)) {
+        printf("Replay saved to %s: %d ticks, score %d, checksum %08x\n",
+            replayPath.c_str(), replayRecorder.GetTickCount(), gameScore.GetScore(), checksum);
+    }
+    else {
+        printf("Could not write replay file %s\n", replayPath.c_str());
+    }
+
+    inputHandler.SetInputSource(replayRestoreSource);
+    replayMode = REPLAY_OFF;
+}
+
+/**
+ * Serializes the simulated world: player, score, timers, held items, all
+ * object vectors with pending commands, and the simulation random streams
+ * Menu and name entry state is not part of the world
+ * @param snapshot Receives the current world
+ */
+void Game::SaveWorld(WorldSnapshot& snapshot) const {
+    WorldState state;
+    state.player = player;
+    state.score = gameScore.GetScore();
+    state.highScore = gameScore.GetHighScore();
+    state.level = gameScore.GetLevel();
+    state.projectileCooldown = projectileCooldown;
+    state.asteroidSpawnTimer = asteroidSpawnTimer;
+    state.currentItem = currentItem;
+    state.amountRapid = amountRapid;
+    state.hasRapid = hasRapid;
+    state.hasShield = hasShield;
+    state.objects = objectManager.GetState();
+    context.SaveRandom(state.random);
+
+    snapshot.Write(state, objectManager.GetAsteroids(), objectManager.GetProjectiles(),
+        objectManager.GetPowerUps(), objectManager.GetPendingCommands());
+}
+
+/**
+ * Replaces the simulated world with a saved one
+ * Continuing from a restored world reproduces the ticks that followed the save
+ * @param snapshot World saved by SaveWorld()
+ * @return False (world unchanged) if the snapshot is invalid
+ */
+bool Game::RestoreWorld(const WorldSnapshot& snapshot) {
+    WorldState state;
+    if (!snapshot.Read(state, objectManager.GetAsteroidsMutable(), objectManager.GetProjectilesMutable(),
+        objectManager.GetPowerUpsMutable(), objectManager.GetPendingCommandsMutable())) {
+        return false;
+    }
+
+    player = state.player;
+    gameScore.Restore(state.score, state.highScore, state.level);
+    projectileCooldown = state.projectileCooldown;
+    asteroidSpawnTimer = state.asteroidSpawnTimer;
+    currentItem = state.currentItem;
+    amountRapid = state.amountRapid;
+    hasRapid = state.hasRapid;
+    hasShield = state.hasShield;
+    objectManager.SetState(state.objects);
+    context.RestoreRandom(state.random);
+    return true;
+}
+
+/**
+ * Computes a checksum of the simulation state
+ * The world checksum shared with multiplayer sessions, plus the held item
+ * @return FNV-1a hash of the game state
+ */
+uint32_t Game::ComputeStateChecksum() const {
+    uint32_t hash = ComputeWorldChecksum(gameScore, &player, 1, objectManager);
+    HashBytes(hash, &currentItem, sizeof(currentItem));
+    return hash;
+}
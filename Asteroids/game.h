@@ -8,8 +8,26 @@
 #include "inputhandler.h"
 #include "uirenderer.h"
 #include "score.h"
+#include "simulationContext.h"
 #include "highscoreManager.h"
 #include "globals.h"
+#include "replay.h"
+#include "renderSnapshot.h"
+#include "frameArena.h"
+#include "worldSnapshot.h"
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+/**
+ * Replay activity of the current session
+ */
+enum ReplayMode {
+    REPLAY_OFF,         // Live input, nothing recorded
+    REPLAY_RECORDING,   // Input is recorded until the session ends
+    REPLAY_PLAYING      // Input comes from a replay file
+};
 
 class Game {
 private:
@@ -21,14 +39,35 @@ private:
     bool hasShield;               // Whether shield protection is currently active
     Sound shootSound;             // Sound effect played when firing projectiles
     Music backgroundMusic;        // Background music stream for atmospheric audio
-    bool gameRunning = true;      // Master flag controlling main game loop execution
+    std::atomic<bool> gameRunning{ true }; // Master flag controlling main game loop execution
+    bool headless;                // Runs without window and audio device (simulation only)
+    float stepAccumulator;        // Frame time not yet consumed by fixed simulation steps
+    int maxStepsPerFrame;         // Upper bound of fixed steps per frame, excess time is dropped
+    int tracedSpawnCount;         // Object manager spawn count at the last trace counter sample
+    ReplayMode replayMode;        // Whether the session is recorded, replayed or neither
+    ReplayRecorder replayRecorder; // Records the input of the current session
+    ReplayPlayer replayPlayer;    // Plays back a loaded replay file
+    InputSource* replayRestoreSource; // Input source to return to when the replay ends
+    std::string replayPath;       // File the recording is written to when the session ends
+    bool replayVerified;          // Whether the last playback matched the recorded results
+    SnapshotBuffer snapshots;     // Render snapshots handed from the simulation to Draw()
+    std::thread simulationThread; // Runs the fixed steps while the simulation is threaded
+    std::atomic<bool> simulationThreaded; // Whether simulationThread owns the simulation
+    FrameArena simulationArena;   // Per-step temporaries of the simulation, reset after every Tick()
+    FrameArena drawArena;         // Per-frame temporaries of the renderer, reset after every Draw()
+    uint64_t tickAllocations;     // Heap allocations made by the last Tick()
+    unsigned int shotsFired;      // Shots fired so far (simulation side)
+    unsigned int highscoreRevision; // Bumped whenever a high score was added (simulation side)
+    unsigned int playedShots;     // Shots the window thread has played a sound for
+    unsigned int savedHighscoreRevision; // High score table revision the window thread last saved
 
     // Game objects
+    SimulationContext context;    // Random streams, score, difficulty and state of the session
     Spaceship player;             // Player-controlled spaceship with movement and combat
-    Score gameScore;              // Scoring system managing points, levels, and high scores
+    Score& gameScore;             // Scoring system managing points, levels, and high scores (owned by context)
 
     // Subsystems
-    GameStateManager stateManager;   // Manages current game state and transitions
+    GameStateManager& stateManager;  // Manages current game state and transitions (owned by context)
     ObjectManager objectManager;     // Handles all game objects (asteroids, projectiles, power-ups)
     CollisionSystem collisionSystem; // Detects and handles all collision interactions
     InputHandler inputHandler;       // Processes user input for different game states
@@ -36,13 +75,17 @@ private:
     HighscoreManager highscoreManager; // Manages persistent high score storage and display
 
 public:
-    Game();
+    Game(bool runHeadless = false /* Skip window and audio device creation */);
     ~Game();
     void Initialize();
     void Update();
+    void Tick(float deltaTime /* Fixed or measured time step in seconds */);
     void Draw();
+    void StartSimulationThread();
+    void StopSimulationThread();
+    bool IsSimulationThreaded() const { return simulationThreaded; }
     bool ShouldClose() {
-        if (gameRunning == false) {
+        if (gameRunning.load() == false) {
             return true;
         }
         else {
@@ -54,13 +97,41 @@ public:
     void SetGameRunning(bool running) {
         gameRunning = running;
     }
-    void PlayShootSound();
+    void QueueShootSound();
     void AddHighscoreEntry(const std::string& name /* Player's name for the high score entry (max 5 characters) */,
         int score /* Achieved score value for the entry */);
     HighscoreManager& GetHighscoreManager(){ 
         return highscoreManager; 
     }
     void ResetGame();
+    void StartNewGame();
+    void SetInputSource(InputSource* source /* Input source, or nullptr for the keyboard */) {
+        inputHandler.SetInputSource(source);
+    }
+    bool IsHeadless() const { return headless; }
+    void SetMaxStepsPerFrame(int steps /* Maximum fixed steps per rendered frame */) {
+        maxStepsPerFrame = steps > 0 ? steps : 1;
+    }
+    int GetMaxStepsPerFrame() const { return maxStepsPerFrame; }
+    uint64_t GetTickAllocations() const { return tickAllocations; }
+    GameState GetState() const { return stateManager.GetCurrentState(); }
+    int GetScore() const { return gameScore.GetScore(); }
+    const ObjectManager& GetObjectManager() const { return objectManager; }
+    ObjectManager& GetObjectManager() { return objectManager; }
+    CollisionSystem& GetCollisionSystem() { return collisionSystem; }
+
+    // Deterministic sessions and replays
+    void SeedRandom(unsigned int seed /* Seed for all simulation random numbers */);
+    bool StartRecordedGame(const char* path /* Replay file written when the session ends */,
+        unsigned int seed /* Random seed of the session */);
+    bool StartReplay(const char* path /* Replay file to play back */);
+    bool IsReplayActive() const { return replayMode != REPLAY_OFF; }
+    bool WasReplayVerified() const { return replayVerified; }
+    uint32_t ComputeStateChecksum() const;
+
+    // World snapshots (rollback, quick-save, test fixtures)
+    void SaveWorld(WorldSnapshot& snapshot /* Receives the current world */) const;
+    bool RestoreWorld(const WorldSnapshot& snapshot /* World saved by SaveWorld */);
 
 private:
     void InitGameSounds();
@@ -71,6 +142,13 @@ private:
     void UpdateInGame(float deltaTime);
     void CheckPowerUpCollisions();
     void HandleGameOver();
+    void TraceCounters();
+    void AdvanceSimulation(float frameTime /* Time to catch up on in seconds */);
+    void PublishSnapshot();
+    void HandleSimulationEvents(const RenderSnapshot& snapshot /* Snapshot just acquired by Draw() */);
+    void SimulationLoop();
+    void UpdateReplay();
+    void FinishRecording();
 };
 
 #endif
\ No newline at end of file
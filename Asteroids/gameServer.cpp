@@ -0,0 +1,387 @@
+#include "gameServer.h"
+#include "globals.h"
+#include "replay.h"
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <thread>
+#include <utility>
+
+/**
+ * Returns the milliseconds between two time points
+ */
+static double MillisecondsBetween(ServerTime start, ServerTime end) {
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+/**
+ * Constructor for LatencyHistogram class - starts empty
+ */
+LatencyHistogram::LatencyHistogram() :
+    counts(),
+    total(0),
+    maxMs(0.0f) {
+}
+
+/**
+ * Counts one latency sample
+ * @param latencyMs Tick completion delay in milliseconds
+ */
+void LatencyHistogram::Add(float latencyMs) {
+    int bucket = (int)(std::max(latencyMs, 0.0f) / LATENCY_BUCKET_MS);
+    counts[std::min(bucket, LATENCY_BUCKETS - 1)]++;
+    total++;
+    maxMs = std::max(maxMs, latencyMs);
+}
+
+/**
+ * Adds another histogram's samples to this one
+ * @param other Histogram to add
+ */
+void LatencyHistogram::Merge(const LatencyHistogram& other) {
+    for (int bucket = 0; bucket < LATENCY_BUCKETS; bucket++) {
+        counts[bucket] += other.counts[bucket];
+    }
+    total += other.total;
+    maxMs = std::max(maxMs, other.maxMs);
+}
+
+/**
+ * Estimates a percentile as the upper edge of the bucket holding it
+ * Never reports more than the largest sample
+ * @param fraction Share of samples at or below the result, 0 - 1
+ * @return Latency in milliseconds (0 without samples)
+ */
+float LatencyHistogram::GetPercentile(float fraction) const {
+    if (total == 0) return 0.0f;
+
+    uint64_t rank = std::min(total - 1, (uint64_t)((double)total * fraction));
+    uint64_t seen = 0;
+    for (int bucket = 0; bucket < LATENCY_BUCKETS - 1; bucket++) {
+        seen += counts[bucket];
+        if (seen > rank) return std::min(maxMs, (bucket + 1) * LATENCY_BUCKET_MS);
+    }
+    return maxMs;
+}
+
+/**
+ * Queues an input packet for the session
+ * @param packet Input from the client
+ */
+void SessionLink::SendInput(const InputPacket& packet) {
+    std::lock_guard<std::mutex> lock(mutex);
+    inputs.push_back(packet);
+}
+
+/**
+ * Takes the oldest input packet
+ * @param packet Receives the packet
+ * @return False if no input is waiting
+ */
+bool SessionLink::ReceiveInput(InputPacket& packet) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (inputs.empty()) return false;
+
+    packet = inputs.front();
+    inputs.pop_front();
+    return true;
+}
+
+/**
+ * Queues a report for the client
+ * @param report State of the session
+ */
+void SessionLink::SendReport(const SessionReport& report) {
+    std::lock_guard<std::mutex> lock(mutex);
+    reports.push_back(report);
+}
+
+/**
+ * Takes the oldest report
+ * @param report Receives the report
+ * @return False if no report is waiting
+ */
+bool SessionLink::ReceiveReport(SessionReport& report) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (reports.empty()) return false;
+
+    report = reports.front();
+    reports.pop_front();
+    return true;
+}
+
+/**
+ * Simulates one tick of a server game and restarts the game once it is over
+ * Shared by the live session and its verification replay
+ * @param world World of the session
+ * @param seed Seed of the session's first game
+ * @param input Input of the ship for this tick
+ * @param games Games finished so far, incremented on a restart
+ */
+static void StepServerGame(SessionWorld& world, uint32_t seed, uint32_t input, int& games) {
+    world.Step(&input);
+    if (world.IsOver()) {
+        games++;
+        world.Reset(seed + (uint32_t)games * 7919u);
+    }
+}
+
+/**
+ * Constructor for ServerSession class
+ * @param sessionIndex Index of the session on the server
+ * @param sessionSeed Seed of the first game
+ * @param clientLink Connection to the client
+ * @param logInputs Log applied inputs for Verify()
+ */
+ServerSession::ServerSession(int sessionIndex, uint32_t sessionSeed, SessionLink& clientLink,
+    bool logInputs) :
+    index(sessionIndex),
+    seed(sessionSeed),
+    world(1, sessionSeed),
+    link(clientLink),
+    lastInput(0),
+    tick(0),
+    games(0),
+    nextTick(),
+    busyMs(0.0),
+    lateInputs(0),
+    keepInputLog(logInputs),
+    logStartGames(0) {
+    for (int slot = 0; slot < SERVER_INPUT_BUFFER; slot++) {
+        inputs[slot] = 0;
+        inputTicks[slot] = -1;
+    }
+    if (keepInputLog) {
+        inputLog.reserve(SERVER_INPUT_LOG_TICKS);
+        world.Save(logStart);
+    }
+}
+
+/**
+ * Moves the client's input packets into the tick buffer
+ * Ticks already simulated or too far ahead are dropped
+ */
+void ServerSession::ReceiveInputs() {
+    InputPacket packet;
+    while (link.ReceiveInput(packet)) {
+        for (int i = 0; i < INPUT_PACKET_HISTORY; i++) {
+            int inputTick = (int)packet.tick - i;
+            if (inputTick < tick || inputTick >= tick + SERVER_INPUT_BUFFER) continue;
+
+            inputs[inputTick % SERVER_INPUT_BUFFER] = packet.masks[i];
+            inputTicks[inputTick % SERVER_INPUT_BUFFER] = inputTick;
+        }
+    }
+}
+
+/**
+ * Runs the ticks that are due
+ * Each tick records how long after its due time it completed; the time
+ * spent simulating is added to the session's busy time
+ * A full input log is restarted from the current world, so only the
+ * last SERVER_INPUT_LOG_TICKS ticks are kept for Verify()
+ * @param now Ticks due at or before this time are run
+ * @param maxTicks Most ticks to run, so one late session cannot hold a thread
+ * @return Number of ticks run
+ */
+int ServerSession::RunDueTicks(ServerTime now, int maxTicks) {
+    const auto period = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(1.0 / SIMULATION_RATE));
+
+    ReceiveInputs();
+
+    int ran = 0;
+    while (nextTick <= now && ran < maxTicks) {
+        ServerTime start = std::chrono::steady_clock::now();
+
+        int slot = tick % SERVER_INPUT_BUFFER;
+        uint32_t input = lastInput;
+        if (inputTicks[slot] == tick) {
+            input = inputs[slot];
+        }
+        else {
+            lateInputs++;
+        }
+        lastInput = input;
+        if (keepInputLog) {
+            if ((int)inputLog.size() == SERVER_INPUT_LOG_TICKS) {
+                world.Save(logStart);
+                logStartGames = games;
+                inputLog.clear();
+            }
+            inputLog.push_back(input);
+        }
+
+        StepServerGame(world, seed, input, games);
+        tick++;
+
+        if (tick % SERVER_REPORT_INTERVAL == 0) {
+            link.SendReport({ index, tick, world.GetScore().GetScore(), world.GetShip(0).GetLives(),
+                games, world.ComputeChecksum() });
+        }
+
+        ServerTime end = std::chrono::steady_clock::now();
+        busyMs += MillisecondsBetween(start, end);
+        tickLatency.Add((float)MillisecondsBetween(nextTick, end));
+        nextTick += period;
+        ran++;
+    }
+
+    return ran;
+}
+
+/**
+ * Replays the logged inputs on the calling thread, starting from the world
+ * the log starts from
+ * Proves that ticking beside other sessions did not change the result
+ * @return True if the replay ends with the session's checksum (false without an input log)
+ */
+bool ServerSession::Verify() const {
+    if (!keepInputLog) return false;
+
+    SessionWorld replay(1, seed);
+    if (!replay.Load(logStart)) return false;
+    int replayGames = logStartGames;
+    for (uint32_t input : inputLog) {
+        StepServerGame(replay, seed, input, replayGames);
+    }
+    return replayGames == games && replay.ComputeChecksum() == world.ComputeChecksum();
+}
+
+/**
+ * Constructor for GameServer class
+ * Creates every session and its client link; sessions start ticking in Run()
+ * @param serverConfig Settings of the run
+ */
+GameServer::GameServer(const ServerConfig& serverConfig) :
+    config(serverConfig),
+    jobs(serverConfig.threads > 0 ? serverConfig.threads - 1 : -1) {
+    for (int i = 0; i < config.sessions; i++) {
+        links.emplace_back(new SessionLink());
+        sessions.emplace_back(new ServerSession(i, config.seed + (uint32_t)i, *links[i], config.keepInputLogs));
+    }
+}
+
+/**
+ * Hosts all sessions for the configured time
+ * Every pass takes the sessions whose next tick is due from the schedule,
+ * ticks them in parallel and puts them back with their new due time; the
+ * scheduling thread sleeps until the earliest due time in between
+ * @param client Client stand-in pumped once per pass, or nullptr
+ * @return Tick cost, latency percentiles and capacity of the run
+ */
+ServerStats GameServer::Run(LocalClient* client) {
+    typedef std::pair<ServerTime, int> ScheduleEntry;
+    std::priority_queue<ScheduleEntry, std::vector<ScheduleEntry>, std::greater<ScheduleEntry>> schedule;
+
+    const auto period = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(1.0 / SIMULATION_RATE));
+    ServerTime start = std::chrono::steady_clock::now();
+    ServerTime end = start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(config.seconds));
+
+    // Stagger the first ticks over one period
+    int count = (int)sessions.size();
+    for (int i = 0; i < count; i++) {
+        ServerTime firstTick = start + period * i / std::max(1, count);
+        sessions[i]->ScheduleFirstTick(firstTick);
+        schedule.push({ firstTick, i });
+    }
+    if (client) client->Pump();
+
+    std::vector<int> due;
+    while (true) {
+        ServerTime now = std::chrono::steady_clock::now();
+        if (now >= end) break;
+
+        due.clear();
+        while (!schedule.empty() && schedule.top().first <= now) {
+            due.push_back(schedule.top().second);
+            schedule.pop();
+        }
+
+        if (due.empty()) {
+            ServerTime wake = schedule.empty() ? end : std::min(schedule.top().first, end);
+            std::this_thread::sleep_until(wake);
+            continue;
+        }
+
+        jobs.ParallelFor(0, (int)due.size(), 1, [&](int first, int last) {
+            for (int i = first; i < last; i++) {
+                sessions[due[i]]->RunDueTicks(now, MAX_STEPS_PER_FRAME);
+            }
+        });
+        for (int session : due) {
+            schedule.push({ sessions[session]->GetNextTickTime(), session });
+        }
+
+        if (client) client->Pump();
+    }
+
+    ServerStats stats;
+    stats.sessions = count;
+    stats.threads = jobs.GetThreadCount();
+    stats.seconds = MillisecondsBetween(start, std::chrono::steady_clock::now()) / 1000.0;
+
+    LatencyHistogram latency;
+    for (const auto& session : sessions) {
+        stats.ticks += session->GetTick();
+        stats.busySeconds += session->GetBusyMs() / 1000.0;
+        stats.lateInputs += session->GetLateInputs();
+        stats.games += session->GetGames();
+        latency.Merge(session->GetTickLatency());
+    }
+
+    if (stats.ticks > 0) {
+        stats.tickCostMs = stats.busySeconds * 1000.0 / stats.ticks;
+        stats.sessionsPerCore = 1000.0 / (stats.tickCostMs * SIMULATION_RATE);
+    }
+    stats.p50LatencyMs = latency.GetPercentile(0.50f);
+    stats.p99LatencyMs = latency.GetPercentile(0.99f);
+    stats.maxLatencyMs = latency.GetMax();
+    return stats;
+}
+
+/**
+ * Constructor for LocalClient class
+ * @param gameServer Server to connect to
+ * @param pilotSeed Seed of the scripted pilots
+ */
+LocalClient::LocalClient(GameServer& gameServer, uint32_t pilotSeed) :
+    server(gameServer),
+    seed(pilotSeed),
+    sentUpTo(gameServer.GetSessionCount(), 0),
+    latest(gameServer.GetSessionCount(), SessionReport{ 0, 0, 0, 0, 0, 0 }),
+    reportCount(0),
+    outOfOrderReports(0) {
+}
+
+/**
+ * Reads the sessions' reports and tops up their input
+ * Input is sent up to CLIENT_INPUT_LEAD ticks past the newest report,
+ * one packet per tick repeating the previous ticks
+ */
+void LocalClient::Pump() {
+    for (int session = 0; session < server.GetSessionCount(); session++) {
+        SessionLink& link = server.GetLink(session);
+
+        SessionReport report;
+        while (link.ReceiveReport(report)) {
+            if (report.tick < latest[session].tick) outOfOrderReports++;
+            latest[session] = report;
+            reportCount++;
+        }
+
+        int target = latest[session].tick + CLIENT_INPUT_LEAD;
+        for (; sentUpTo[session] < target; sentUpTo[session]++) {
+            InputPacket packet;
+            packet.player = 0;
+            packet.tick = (uint32_t)sentUpTo[session];
+            for (int i = 0; i < INPUT_PACKET_HISTORY; i++) {
+                int tick = sentUpTo[session] - i;
+                packet.masks[i] = tick >= 0 ? ReplayKeys::PilotMask(seed + (uint32_t)session, 0, tick) : 0;
+            }
+            link.SendInput(packet);
+        }
+    }
+}
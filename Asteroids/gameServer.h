@@ -0,0 +1,210 @@
+#ifndef GAMESERVER_H
+#define GAMESERVER_H
+
+#include "jobSystem.h"
+#include "netTransport.h"
+#include "sessionWorld.h"
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#define SERVER_INPUT_BUFFER 128     // Ticks of client input a session buffers ahead
+#define SERVER_REPORT_INTERVAL 30   // Ticks between state reports to the client
+#define CLIENT_INPUT_LEAD 60        // Ticks of input the client stand-in sends ahead of the last report
+#define SERVER_INPUT_LOG_TICKS 7200 // Most logged inputs a session keeps for Verify() (one minute)
+#define LATENCY_BUCKET_MS 0.05f     // Width of one tick latency histogram bucket
+#define LATENCY_BUCKETS 1024        // Histogram buckets; the last one also counts everything slower
+
+typedef std::chrono::steady_clock::time_point ServerTime;
+
+/**
+ * State of a server session as reported to its client
+ */
+struct SessionReport {
+    int session;        // Index of the session
+    int tick;           // Ticks simulated so far
+    int score;          // Current score
+    int lives;          // Lives of the ship
+    int games;          // Games finished so far
+    uint32_t checksum;  // World checksum after the tick
+};
+
+/**
+ * LatencyHistogram class counting tick latencies in fixed-width buckets
+ * Memory stays the same however long the server runs; percentiles are
+ * exact to one bucket width, the maximum is kept exactly
+ */
+class LatencyHistogram {
+private:
+    uint32_t counts[LATENCY_BUCKETS];   // Samples per bucket
+    uint64_t total;                     // Samples recorded
+    float maxMs;                        // Largest sample
+
+public:
+    LatencyHistogram();
+
+    void Add(float latencyMs /* Tick completion delay in milliseconds */);
+    void Merge(const LatencyHistogram& other /* Histogram to add to this one */);
+    float GetPercentile(float fraction /* Share of samples at or below the result, 0 - 1 */) const;
+    float GetMax() const { return maxMs; }
+    uint64_t GetCount() const { return total; }
+};
+
+/**
+ * SessionLink class connecting a client to its server session
+ * Two locked queues: input packets to the server, reports to the client.
+ * Both sides may run on different threads
+ */
+class SessionLink {
+private:
+    std::mutex mutex;                       // Guards both queues
+    std::deque<InputPacket> inputs;         // Input packets waiting for the session
+    std::deque<SessionReport> reports;      // Reports waiting for the client
+
+public:
+    void SendInput(const InputPacket& packet /* Input from the client */);
+    bool ReceiveInput(InputPacket& packet /* Receives the oldest input */);
+    void SendReport(const SessionReport& report /* State for the client */);
+    bool ReceiveReport(SessionReport& report /* Receives the oldest report */);
+};
+
+/**
+ * ServerSession class running one authoritative single-player game
+ * Ticks on its own schedule, applies the client's input for each tick
+ * (repeating the previous input if it has not arrived) and restarts with
+ * a new seed when the ship runs out of lives
+ * Tick latencies go into a fixed histogram and the input log is bounded,
+ * so a session's memory does not grow with the length of the run
+ *
+ * All simulation state lives in the session's SessionWorld, so sessions
+ * can tick concurrently on different threads
+ */
+class ServerSession {
+private:
+    int index;                                  // Index of the session on the server
+    uint32_t seed;                              // Seed of the first game
+    SessionWorld world;                         // Ship, objects, collisions and score
+    SessionLink& link;                          // Connection to the client
+    uint32_t inputs[SERVER_INPUT_BUFFER];       // Buffered client input per tick
+    int inputTicks[SERVER_INPUT_BUFFER];        // Tick each input slot holds (-1 = empty)
+    uint32_t lastInput;                         // Input of the previous tick
+    int tick;                                   // Ticks simulated so far
+    int games;                                  // Games finished so far
+    ServerTime nextTick;                        // When the next tick is due
+    LatencyHistogram tickLatency;               // Completion minus due time of every tick
+    double busyMs;                              // Time spent simulating
+    int lateInputs;                             // Ticks whose input had not arrived
+    bool keepInputLog;                          // Whether applied inputs are logged
+    std::vector<uint32_t> inputLog;             // Input applied per tick since logStart (when logging)
+    SessionFrame logStart;                      // World the input log starts from
+    int logStartGames;                          // Games finished when the input log started
+
+    void ReceiveInputs();
+
+public:
+    ServerSession(int sessionIndex /* Index on the server */,
+        uint32_t sessionSeed /* Seed of the first game */,
+        SessionLink& clientLink /* Connection to the client */,
+        bool logInputs /* Log applied inputs for verification */);
+
+    void ScheduleFirstTick(ServerTime firstTick /* When the first tick is due */) { nextTick = firstTick; }
+    int RunDueTicks(ServerTime now /* Ticks due up to this time are run */,
+        int maxTicks /* Most ticks to run in this call */);
+
+    ServerTime GetNextTickTime() const { return nextTick; }
+    int GetIndex() const { return index; }
+    int GetTick() const { return tick; }
+    int GetGames() const { return games; }
+    int GetLateInputs() const { return lateInputs; }
+    double GetBusyMs() const { return busyMs; }
+    const LatencyHistogram& GetTickLatency() const { return tickLatency; }
+    const std::vector<uint32_t>& GetInputLog() const { return inputLog; }
+    uint32_t ComputeChecksum() const { return world.ComputeChecksum(); }
+    bool Verify() const;
+};
+
+/**
+ * Settings of a server run
+ */
+struct ServerConfig {
+    int sessions = 256;             // Concurrent sessions
+    int threads = 0;                // Simulation threads, 0 = hardware threads
+    float seconds = 10.0f;          // Length of the run
+    uint32_t seed = 12345;          // Seed of session 0; session i uses seed + i
+    bool keepInputLogs = false;     // Log applied inputs so sessions can be verified
+};
+
+/**
+ * Results of a server run
+ */
+struct ServerStats {
+    int sessions = 0;               // Concurrent sessions
+    int threads = 0;                // Simulation threads
+    double seconds = 0.0;           // Wall time of the run
+    long long ticks = 0;            // Ticks simulated by all sessions
+    double busySeconds = 0.0;       // Simulation time summed over all sessions
+    double tickCostMs = 0.0;        // Average simulation time of one tick
+    double sessionsPerCore = 0.0;   // Sessions one core can tick at SIMULATION_RATE
+    float p50LatencyMs = 0.0f;      // Median tick completion delay
+    float p99LatencyMs = 0.0f;      // 99th percentile tick completion delay
+    float maxLatencyMs = 0.0f;      // Worst tick completion delay
+    int lateInputs = 0;             // Ticks run without their client input
+    int games = 0;                  // Games finished by all sessions
+};
+
+class LocalClient;
+
+/**
+ * GameServer class hosting many isolated sessions in one process
+ * Sessions are scheduled individually: a queue ordered by due time hands
+ * every pass the sessions whose next tick is due, and the job system ticks
+ * them in parallel. First ticks are staggered over one tick period so the
+ * sessions' work spreads evenly instead of arriving in bursts
+ */
+class GameServer {
+private:
+    ServerConfig config;                                // Settings of the run
+    JobSystem jobs;                                     // Threads ticking the sessions
+    std::vector<std::unique_ptr<SessionLink>> links;    // One client connection per session
+    std::vector<std::unique_ptr<ServerSession>> sessions;   // Hosted sessions
+
+public:
+    explicit GameServer(const ServerConfig& serverConfig /* Settings of the run */);
+
+    ServerStats Run(LocalClient* client /* Client stand-in pumped by the scheduler, or nullptr */);
+
+    int GetSessionCount() const { return (int)sessions.size(); }
+    SessionLink& GetLink(int session /* Session index */) { return *links[session]; }
+    const ServerSession& GetSession(int session /* Session index */) const { return *sessions[session]; }
+};
+
+/**
+ * LocalClient class standing in for the players of every session
+ * Sends scripted pilot input (ReplayKeys::PilotMask) CLIENT_INPUT_LEAD ticks
+ * ahead of the newest report, the way a client with a jitter buffer would,
+ * and keeps the newest report of each session
+ */
+class LocalClient {
+private:
+    GameServer& server;                     // Server whose links are used
+    uint32_t seed;                          // Pilot seed, same as the server's
+    std::vector<int> sentUpTo;              // Input sent for every tick before this, per session
+    std::vector<SessionReport> latest;      // Newest report per session
+    int reportCount;                        // Reports received
+    int outOfOrderReports;                  // Reports older than the previous one
+
+public:
+    LocalClient(GameServer& gameServer /* Server to connect to */,
+        uint32_t pilotSeed /* Seed of the scripted pilots */);
+
+    void Pump();
+
+    const SessionReport& GetLatestReport(int session /* Session index */) const { return latest[session]; }
+    int GetReportCount() const { return reportCount; }
+    int GetOutOfOrderReports() const { return outOfOrderReports; }
+};
+
+#endif
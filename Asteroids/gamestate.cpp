@@ -1,9 +1,7 @@
 #include "gamestate.h"
+#include "simulationContext.h"
 #include <iostream>
 
-// Global instance for C-style interface compatibility
-static GameStateManager g_stateManager;
-
 /**
  * Constructor for GameStateManager class
  * Initializes all state management variables to default values
@@ -109,63 +107,70 @@ const char* GameStateManager::GetStateName(GameState state) {
     }
 }
 
-// C-style interface implementation for compatibility with C code
+// C-style interface implementation, every call names the session it acts on
 namespace GameStateUtils {
 
     /**
-     * Initializes the global game state manager instance
+     * Resets a session's game state manager
      * Creates a fresh GameStateManager with default settings
+     * @param context Session whose state is reset
      */
-    void Initialize() {
-        g_stateManager = GameStateManager();
+    void Initialize(SimulationContext& context) {
+        context.GetStateManager() = GameStateManager();
     }
 
     /**
-     * Sets the current game state through the global instance
+     * Sets the current game state of a session
+     * @param context Session to change
      * @param newState The target game state to transition to
      */
-    void SetState(GameState newState) {
-        g_stateManager.SetState(newState);
+    void SetState(SimulationContext& context, GameState newState) {
+        context.GetStateManager().SetState(newState);
     }
 
     /**
      * Gets the current active game state
+     * @param context Session to query
      * @return Current GameState enum value
      */
-    GameState GetCurrentState() {
-        return g_stateManager.GetCurrentState();
+    GameState GetCurrentState(const SimulationContext& context) {
+        return context.GetStateManager().GetCurrentState();
     }
 
     /**
      * Gets the previously active game state
+     * @param context Session to query
      * @return Previous GameState enum value
      */
-    GameState GetPreviousState() {
-        return g_stateManager.GetPreviousState();
+    GameState GetPreviousState(const SimulationContext& context) {
+        return context.GetStateManager().GetPreviousState();
     }
 
     /**
      * Checks if a state change has occurred recently
+     * @param context Session to query
      * @return True if state has changed and is still in transition period
      */
-    bool HasStateChanged() {
-        return g_stateManager.HasStateChanged();
+    bool HasStateChanged(const SimulationContext& context) {
+        return context.GetStateManager().HasStateChanged();
     }
 
     /**
-     * Updates the global state manager with delta time
+     * Updates a session's state manager with delta time
+     * @param context Session to update
      * @param deltaTime Time elapsed since last frame in seconds
      */
-    void Update(float deltaTime) {
-        g_stateManager.Update(deltaTime);
+    void Update(SimulationContext& context, float deltaTime) {
+        context.GetStateManager().Update(deltaTime);
     }
 
     /**
      * Manually clears the state change flag
      * Forces the state manager to consider the transition complete
+     * @param context Session to change
      */
-    void ClearStateChange() {
-        g_stateManager.ClearStateChange();
+    void ClearStateChange(SimulationContext& context) {
+        context.GetStateManager().ClearStateChange();
     }
 
     /**
@@ -179,17 +184,19 @@ namespace GameStateUtils {
 
     /**
      * Checks if the current state is a gameplay state
+     * @param context Session to query
      * @return True if currently in an active playing state
      */
-    bool IsPlayingState() {
-        return g_stateManager.IsPlayingState();
+    bool IsPlayingState(const SimulationContext& context) {
+        return context.GetStateManager().IsPlayingState();
     }
 
     /**
      * Checks if the current state is a menu-based state
+     * @param context Session to query
      * @return True if currently in a menu or UI state
      */
-    bool IsMenuState() {
-        return g_stateManager.IsMenuState();
+    bool IsMenuState(const SimulationContext& context) {
+        return context.GetStateManager().IsMenuState();
     }
 }
\ No newline at end of file
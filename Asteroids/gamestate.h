@@ -103,18 +103,21 @@ public:
     static const char* GetStateName(GameState state /* Game state to get name for */);
 };
 
-// Utility functions for interface
+class SimulationContext;
+
+// Utility functions for interface, acting on a session's state manager
 namespace GameStateUtils {
-    void Initialize();
-    void SetState(GameState newState /* Target state to transition to */);
-    GameState GetCurrentState();
-    GameState GetPreviousState();
-    bool HasStateChanged();
-    void Update(float deltaTime);
-    void ClearStateChange();
+    void Initialize(SimulationContext& context /* Session whose state is reset */);
+    void SetState(SimulationContext& context /* Session to change */,
+        GameState newState /* Target state to transition to */);
+    GameState GetCurrentState(const SimulationContext& context /* Session to query */);
+    GameState GetPreviousState(const SimulationContext& context /* Session to query */);
+    bool HasStateChanged(const SimulationContext& context /* Session to query */);
+    void Update(SimulationContext& context /* Session to update */, float deltaTime);
+    void ClearStateChange(SimulationContext& context /* Session to change */);
     const char* GetStateName(GameState state /* Game state to get name for */);
-    bool IsPlayingState();
-    bool IsMenuState();
+    bool IsPlayingState(const SimulationContext& context /* Session to query */);
+    bool IsMenuState(const SimulationContext& context /* Session to query */);
 }
 
 #endif
\ No newline at end of file
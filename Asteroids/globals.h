@@ -32,15 +32,22 @@
 // PowerUp constants
 #define POWERUP_LIFETIME 15.0f      // Time in seconds before power-up expires
 #define POWERUP_SPAWN_INTERVAL 15.0f // Time in seconds between automatic power-up spawns
+#define POWERUP_RADIUS 20.0f        // Pickup radius in pixels around the power-up center
+
+// Collision constants
+#define COLLISION_CELL_SIZE 80.0f   // Broadphase grid cell size in pixels (diameter of a large asteroid)
+#define PARALLEL_GRAIN 4096         // Fewest entities per job of a parallel update (above a game's pool sizes, so games stay serial)
+
+// Simulation timing constants
+#define SIMULATION_RATE 120                         // Fixed simulation steps per second
+#define FIXED_TIME_STEP (1.0f / SIMULATION_RATE)    // Duration of one simulation step in seconds
+#define MAX_STEPS_PER_FRAME 8                       // Steps per rendered frame before simulation time is dropped
 
 // Mathematical constants (only if not already defined)
 #ifndef WINKEL2GRAD
 #define WINKEL2GRAD 0.017453293f    // Conversion factor from degrees to radians (π/180)
 #endif
 
-// Global score variable for progressive difficulty
-extern int g_currentScore;          // Current game score used for difficulty scaling
-
 // Helper functions (use std:: versions to avoid conflicts)
 inline float SafeMax(float a /* First value to compare */,
     float b /* Second value to compare */) {
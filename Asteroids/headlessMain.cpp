@@ -0,0 +1,273 @@
+#include "game.h"
+#include "inputSource.h"
+#include "benchmarks.h"
+#include "profiler.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <iostream>
+
+#define ALLOCATION_WARMUP_TICKS (10 * SIMULATION_RATE)    // Ticks before allocations count as steady state
+
+/**
+ * Options of the headless runner, parsed from the command line
+ */
+struct HeadlessOptions {
+    int ticks = 600 * SIMULATION_RATE;  // Simulation ticks to run (10 minutes)
+    float deltaTime = FIXED_TIME_STEP;  // Fixed time step in seconds
+    unsigned int seed = 12345;          // Random seed for spawning and collisions
+    bool bruteForce = false;            // Disable the collision broadphase
+    bool benchCollision = false;        // Run the collision benchmark instead of the soak test
+    bool benchUpdate = false;           // Run the update throughput benchmark
+    bool verifyKernels = false;         // Check SIMD kernels against the scalar path
+    bool verifyHandles = false;         // Check that projectile handles detect reused slots
+    bool benchParallel = false;         // Measure parallel update scaling over thread counts
+    bool benchSnapshot = false;         // Measure world snapshot save/restore
+    bool benchRollback = false;         // Play rollback multiplayer matches and compare the sessions
+    bool checkAllocations = false;      // Fail the soak test if a steady in-game tick allocates
+    int threads = 1;                    // Highest thread count of --bench-parallel (1 = hardware threads)
+    const char* tracePath = nullptr;    // Chrome trace output of the soak test, if any
+    const char* recordPath = nullptr;   // Replay file recording the first soak session
+    const char* replayPath = nullptr;   // Replay file to play back and verify
+};
+
+/**
+ * Prints the command line usage of the headless runner
+ */
+static void PrintUsage() {
+    printf("Usage: AsteroidsHeadless [options]\n");
+    printf("  --ticks N          Simulation ticks to run (default %d)\n", 600 * SIMULATION_RATE);
+    printf("  --dt SECONDS       Fixed time step (default %f)\n", FIXED_TIME_STEP);
+    printf("  --seed N           Random seed (default 12345)\n");
+    printf("  --brute-force      Disable the collision broadphase\n");
+    printf("  --bench-collision  Compare broadphase and brute force collision checks\n");
+    printf("  --bench-update     Measure asteroid update throughput (10k - 100k)\n");
+    printf("  --verify-kernels   Check SIMD kernels against the scalar reference\n");
+    printf("  --verify-handles   Check that projectile handles go stale when their slot is reclaimed\n");
+    printf("  --bench-parallel   Measure parallel update scaling from 1 to N threads (50k, 100k)\n");
+    printf("  --bench-snapshot   Measure world snapshot save/restore (1k, 10k entities)\n");
+    printf("  --bench-rollback   Measure rollback multiplayer (2 - 4 players, in-process and UDP loopback)\n");
+    printf("  --check-allocs     Fail the soak test if a steady in-game tick allocates heap memory\n");
+    printf("  --threads N        Highest --bench-parallel thread count (default: hardware threads)\n");
+    printf("  --trace FILE       Write a Chrome trace of the soak test\n");
+    printf("  --record FILE      Record the first soak session to a replay file\n");
+    printf("  --replay FILE      Play back a replay and verify score and state\n");
+}
+
+/**
+ * Parses the command line into runner options
+ * @param argc Argument count
+ * @param argv Argument values
+ * @param options Options to fill
+ * @return False if an argument is unknown or incomplete
+ */
+static bool ParseOptions(int argc, char** argv, HeadlessOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        bool hasValue = i + 1 < argc;
+
+        if (strcmp(arg, "--ticks") == 0 && hasValue) options.ticks = atoi(argv[++i]);
+        else if (strcmp(arg, "--dt") == 0 && hasValue) options.deltaTime = (float)atof(argv[++i]);
+        else if (strcmp(arg, "--seed") == 0 && hasValue) options.seed = (unsigned int)strtoul(argv[++i], nullptr, 10);
+        else if (strcmp(arg, "--brute-force") == 0) options.bruteForce = true;
+        else if (strcmp(arg, "--bench-collision") == 0) options.benchCollision = true;
+        else if (strcmp(arg, "--bench-update") == 0) options.benchUpdate = true;
+        else if (strcmp(arg, "--verify-kernels") == 0) options.verifyKernels = true;
+        else if (strcmp(arg, "--verify-handles") == 0) options.verifyHandles = true;
+        else if (strcmp(arg, "--bench-parallel") == 0) options.benchParallel = true;
+        else if (strcmp(arg, "--bench-snapshot") == 0) options.benchSnapshot = true;
+        else if (strcmp(arg, "--bench-rollback") == 0) options.benchRollback = true;
+        else if (strcmp(arg, "--check-allocs") == 0) options.checkAllocations = true;
+        else if (strcmp(arg, "--threads") == 0 && hasValue) options.threads = atoi(argv[++i]);
+        else if (strcmp(arg, "--trace") == 0 && hasValue) options.tracePath = argv[++i];
+        else if (strcmp(arg, "--record") == 0 && hasValue) options.recordPath = argv[++i];
+        else if (strcmp(arg, "--replay") == 0 && hasValue) options.replayPath = argv[++i];
+        else return false;
+    }
+    return options.ticks > 0 && options.deltaTime > 0.0f && options.threads > 0;
+}
+
+/**
+ * Builds the looping input script used for soak tests
+ * Alternates thrusting, turning and shooting, and uses held items regularly
+ */
+static void BuildPilotScript(ScriptedInputSource& script) {
+    const int ticksPerSecond = SIMULATION_RATE;
+    script.AddStep(ticksPerSecond / 2, { KEY_UP, KEY_LEFT });
+    script.AddStep(ticksPerSecond * 3 / 4, { KEY_SPACE, KEY_RIGHT });
+    script.AddStep(ticksPerSecond / 3, { KEY_SPACE }, { KEY_LEFT_SHIFT });
+    script.AddStep(ticksPerSecond * 5 / 12, { KEY_SPACE, KEY_LEFT });
+    script.AddStep(ticksPerSecond / 6, {});
+    script.SetLooping(true);
+}
+
+/**
+ * Runs the game simulation headless from the pilot script with a fixed time step
+ * A new session starts whenever the previous one ends
+ * @param options Runner options
+ * @return Process exit code
+ */
+static int RunSoakTest(const HeadlessOptions& options) {
+    ScriptedInputSource script;
+    BuildPilotScript(script);
+
+    Game game(true);
+    game.SeedRandom(options.seed);
+    game.SetInputSource(&script);
+    game.GetCollisionSystem().SetBroadphaseEnabled(!options.bruteForce);
+    game.Initialize();
+    if (options.recordPath) {
+        game.StartRecordedGame(options.recordPath, options.seed);
+    }
+    else {
+        game.StartNewGame();
+    }
+
+    if (options.tracePath && !Trace::Start(options.tracePath)) {
+        printf("Cannot write trace file %s\n", options.tracePath);
+        return 1;
+    }
+
+    int sessions = 1;
+    int bestScore = 0;
+    double totalMs = 0.0;
+    double maxTickMs = 0.0;
+    int steadyTicks = 0;
+    int allocatingTicks = 0;
+    uint64_t steadyAllocations = 0;
+
+    for (int tick = 0; tick < options.ticks; tick++) {
+        bool wasInGame = game.GetState() == IN_GAME;
+        auto start = std::chrono::steady_clock::now();
+        game.Tick(options.deltaTime);
+        Profiler::EndFrame();
+        double tickMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        // Steady state: past the warm-up and in game before and after the tick
+        if (tick >= ALLOCATION_WARMUP_TICKS && wasInGame && game.GetState() == IN_GAME) {
+            steadyTicks++;
+            steadyAllocations += game.GetTickAllocations();
+            if (game.GetTickAllocations() > 0) allocatingTicks++;
+        }
+
+        totalMs += tickMs;
+        if (tickMs > maxTickMs) maxTickMs = tickMs;
+
+        if (game.GetState() != IN_GAME) {
+            if (game.GetScore() > bestScore) bestScore = game.GetScore();
+            game.StartNewGame();
+            sessions++;
+        }
+    }
+    if (game.GetScore() > bestScore) bestScore = game.GetScore();
+    Trace::Stop();
+
+    const ObjectManager& objects = game.GetObjectManager();
+    printf("Soak test: %d ticks at %.4f s, seed %u, %s\n", options.ticks, options.deltaTime,
+        options.seed, options.bruteForce ? "brute force" : "broadphase");
+    printf("  Sessions     %d\n", sessions);
+    printf("  Best score   %d\n", bestScore);
+    printf("  Final score  %d\n", game.GetScore());
+    printf("  Tick time    %.4f ms avg, %.4f ms max\n", totalMs / options.ticks, maxTickMs);
+    printf("  Asteroids    %d live, peak %d\n", objects.GetAsteroidStats().live, objects.GetAsteroidStats().peak);
+    printf("  Projectiles  %d live, peak %d\n", objects.GetProjectileStats().live, objects.GetProjectileStats().peak);
+#if ENABLE_ALLOCATION_COUNTER
+    printf("  Heap allocs  %llu in %d of %d steady in-game ticks\n", (unsigned long long)steadyAllocations,
+        allocatingTicks, steadyTicks);
+#else
+    printf("  Heap allocs  not counted (ENABLE_ALLOCATION_COUNTER is 0)\n");
+#endif
+    printf("  Zones over the last %d ticks (ms avg / p99 / max):\n", Profiler::GetFrameCount());
+    for (int zone = ZONE_TICK; zone < PROFILE_ZONE_COUNT; zone++) {
+        ZoneStats stats = Profiler::GetStats((ProfileZone)zone);
+        if (stats.max == 0.0f) continue;
+        printf("    %-12s %.4f / %.4f / %.4f\n", Profiler::GetZoneName((ProfileZone)zone),
+            stats.average, stats.p99, stats.max);
+    }
+    if (options.checkAllocations && (!ENABLE_ALLOCATION_COUNTER || steadyAllocations > 0)) {
+        printf("Allocation check FAILED%s\n", ENABLE_ALLOCATION_COUNTER ? "" : " (counter compiled out)");
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * Plays a replay file back headless and checks it reproduces the recording
+ * @param options Runner options
+ * @return 0 if score and state checksum match the recording
+ */
+static int RunReplay(const HeadlessOptions& options) {
+    Game game(true);
+    game.Initialize();
+    if (!game.StartReplay(options.replayPath)) {
+        printf("Cannot load replay %s\n", options.replayPath);
+        return 1;
+    }
+
+    while (game.IsReplayActive()) {
+        game.Tick(options.deltaTime);
+    }
+    return game.WasReplayVerified() ? 0 : 1;
+}
+
+int main(int argc, char** argv) {
+    HeadlessOptions options;
+    if (!ParseOptions(argc, argv, options)) {
+        PrintUsage();
+        return 1;
+    }
+
+    try {
+        if (options.verifyKernels) {
+            return Benchmarks::VerifyKernels(10007, options.seed) ? 0 : 1;
+        }
+        if (options.verifyHandles) {
+            return Benchmarks::VerifyProjectileHandles(options.seed) ? 0 : 1;
+        }
+        if (options.benchCollision) {
+            Benchmarks::RunCollisionBenchmark(200, 50, 600, options.seed);
+            Benchmarks::RunCollisionBenchmark(2000, 500, 100, options.seed);
+            return 0;
+        }
+        if (options.benchUpdate) {
+            const int counts[] = { 10000, 25000, 50000, 100000 };
+            for (int count : counts) {
+                Benchmarks::RunUpdateBenchmark(count, 1000, options.seed);
+            }
+            return 0;
+        }
+        if (options.benchParallel) {
+            int maxThreads = options.threads > 1 ? options.threads : 0;
+            Benchmarks::RunParallelBenchmark(50000, 200, maxThreads, options.seed);
+            Benchmarks::RunParallelBenchmark(100000, 100, maxThreads, options.seed);
+            return 0;
+        }
+        if (options.benchSnapshot) {
+            bool match = Benchmarks::RunSnapshotBenchmark(1000, 10000, options.seed);
+            match = Benchmarks::RunSnapshotBenchmark(10000, 1000, options.seed) && match;
+            return match ? 0 : 1;
+        }
+        if (options.benchRollback) {
+            const int ticks = 20 * SIMULATION_RATE;
+            bool match = Benchmarks::RunRollbackBenchmark(2, ticks, 4, false, options.seed);
+            match = Benchmarks::RunRollbackBenchmark(4, ticks, 12, false, options.seed) && match;
+            match = Benchmarks::RunRollbackBenchmark(2, ticks, 0, true, options.seed) && match;
+            match = Benchmarks::RunRollbackBenchmark(4, ticks, 0, true, options.seed) && match;
+            return match ? 0 : 1;
+        }
+        if (options.replayPath) {
+            return RunReplay(options);
+        }
+        return RunSoakTest(options);
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Headless error: " << e.what() << std::endl;
+        return -1;
+    }
+    catch (...) {
+        std::cerr << "Unknown error in headless run!" << std::endl;
+        return -2;
+    }
+}
@@ -17,7 +17,7 @@ HighscoreManager::HighscoreManager() {
  * Ensures no highscore data is lost when the object is destroyed
  */
 HighscoreManager::~HighscoreManager() {
-    SaveHighscores();
+    WriteHighscores(highscores);
 }
 
 /**
@@ -57,14 +57,17 @@ void HighscoreManager::LoadHighscores() {
 }
 
 /**
- * Saves all current highscores to the data file
+ * Saves a highscore table to the data file
  * Writes name-score pairs to "highscores.dat" in plain text format
  * Each entry is written on a separate line with space separation
+ * Static so the window thread can save the copy in a render snapshot
+ * while the simulation thread keeps using the manager
+ * @param entries Sorted table to write
  */
-void HighscoreManager::SaveHighscores() {
+void HighscoreManager::WriteHighscores(const std::vector<HighscoreEntry>& entries) {
     std::ofstream file("highscores.dat");
     if (file.is_open()) {
-        for (const auto& entry : highscores) {
+        for (const auto& entry : entries) {
             file << entry.name << " " << entry.score << "\n";
         }
         file.close();
@@ -100,7 +103,7 @@ bool HighscoreManager::IsNewHighscore(int score) const {
 
 /**
  * Adds a new highscore entry to the list
- * Automatically sorts the list and saves to file after adding
+ * Automatically sorts the list; the caller saves it with WriteHighscores
  * The new entry will be inserted in the correct position based on score
  * @param name Player's name for the highscore entry
  * @param score Player's achieved score
@@ -108,7 +111,6 @@ bool HighscoreManager::IsNewHighscore(int score) const {
 void HighscoreManager::AddHighscore(const std::string& name, int score) {
     highscores.emplace_back(name, score);
     SortHighscores();
-    SaveHighscores();
 }
 
 /**
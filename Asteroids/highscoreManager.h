@@ -22,7 +22,6 @@ private:
     static const int MAX_HIGHSCORES = 10;      // Maximum number of high scores to store
 
     void LoadHighscores();
-    void SaveHighscores();
     void SortHighscores();
 
 public:
@@ -38,6 +37,8 @@ public:
     // Getter
     const std::vector<HighscoreEntry>& GetHighscores() const { return highscores; }
     int GetLowestHighscore() const;
+
+    static void WriteHighscores(const std::vector<HighscoreEntry>& entries /* Sorted table to write */);
 };
 
 #endif
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include "objectManager.h"
 #include "globals.h"
 #include "game.h" 
+#include "profiler.h"
 
 /**
  * Constructor for InputHandler class
@@ -26,16 +27,46 @@ InputHandler::InputHandler(Game& gameRef, GameStateManager& stateMgr, ObjectMana
     currentItem(item),
     hasRapid(rapid),
     amountRapid(rapidAmount),
-    hasShield(shield) {
+    hasShield(shield),
+    input(&keyboardInput) {
+}
+
+/**
+ * Replaces the source all key queries are routed through
+ * Lets the headless target drive the game from a script instead of the keyboard
+ * @param source Input source to use, or nullptr to restore the raylib keyboard
+ */
+void InputHandler::SetInputSource(InputSource* source) {
+    input = source ? source : &keyboardInput;
+}
+
+/**
+ * Notifies the input source that a new rendered frame started
+ * Must be called once per frame before the frame's simulation ticks
+ */
+void InputHandler::BeginFrame() {
+    input->NextFrame();
+}
+
+/**
+ * Reads the keyboard on the thread owning the window
+ * Used while the simulation runs on its own thread; the next BeginFrame()
+ * on the simulation thread hands the captured keys to the ticks
+ */
+void InputHandler::CaptureKeyboard() {
+    keyboardInput.Capture();
 }
 
 /**
  * Main input handling dispatcher method
  * Routes input handling to appropriate state-specific methods
- * Called every frame to process user input based on current game state
+ * Called every simulation tick to process user input based on current game state
  * @param deltaTime Time elapsed since last frame in seconds
  */
 void InputHandler::HandleInput(float deltaTime) {
+    PROFILE_SCOPE(ZONE_INPUT);
+    input->NextTick();
+
     switch (stateManager.GetCurrentState()) {
     case MAIN_MENU:
         HandleMainMenuInput();
@@ -69,21 +100,20 @@ void InputHandler::HandleInput(float deltaTime) {
  */
 void InputHandler::HandleMainMenuInput() {
     // Navigation in main menu (now 5 options)
-    if (IsKeyPressed(KEY_UP) || IsKeyPressed(KEY_W)) {
+    if (input->IsKeyPressed(KEY_UP) || input->IsKeyPressed(KEY_W)) {
         int selection = stateManager.GetMenuSelection();
         stateManager.SetMenuSelection((selection - 1 + 5) % 5);
     }
-    else if (IsKeyPressed(KEY_DOWN) || IsKeyPressed(KEY_S)) {
+    else if (input->IsKeyPressed(KEY_DOWN) || input->IsKeyPressed(KEY_S)) {
         int selection = stateManager.GetMenuSelection();
         stateManager.SetMenuSelection((selection + 1) % 5);
     }
 
     // Confirm selection
-    if (IsKeyPressed(KEY_ENTER)) {
+    if (input->IsKeyPressed(KEY_ENTER)) {
         switch (stateManager.GetMenuSelection()) {
         case 0: // START GAME
-            game.ResetGame(); // Reset game before starting!
-            stateManager.SetState(IN_GAME);
+            game.StartNewGame();
             break;
         case 1: // CONTROLS
             stateManager.SetState(OPTIONS);
@@ -101,7 +131,7 @@ void InputHandler::HandleMainMenuInput() {
     }
 
     // Alternative: ESC to quit
-    if (IsKeyPressed(KEY_ESCAPE)) {
+    if (input->IsKeyPressed(KEY_ESCAPE)) {
         game.SetGameRunning(false);
     }
 }
@@ -116,7 +146,7 @@ void InputHandler::HandleGameInput(float deltaTime) {
     auto& player = objectManager.GetPlayer();
 
     // Movement controls
-    if (IsKeyDown(KEY_UP) || IsKeyDown(KEY_W)) {
+    if (input->IsKeyDown(KEY_UP) || input->IsKeyDown(KEY_W)) {
         player.StartThrust();
         player.ApplyThrust(deltaTime);
     }
@@ -125,15 +155,15 @@ void InputHandler::HandleGameInput(float deltaTime) {
     }
 
     // Rotation
-    if (IsKeyDown(KEY_LEFT) || IsKeyDown(KEY_A)) {
+    if (input->IsKeyDown(KEY_LEFT) || input->IsKeyDown(KEY_A)) {
         player.Rotate(-1, deltaTime);
     }
-    if (IsKeyDown(KEY_RIGHT) || IsKeyDown(KEY_D)) {
+    if (input->IsKeyDown(KEY_RIGHT) || input->IsKeyDown(KEY_D)) {
         player.Rotate(1, deltaTime);
     }
 
     // Shooting
-    if (IsKeyDown(KEY_SPACE) && projectileCooldown <= 0) {
+    if (input->IsKeyDown(KEY_SPACE) && projectileCooldown <= 0) {
         Vector2 playerPos = player.GetPosition();
         float playerRotation = player.GetRotation();
         float radian = playerRotation * DEG2RAD;
@@ -144,7 +174,7 @@ void InputHandler::HandleGameInput(float deltaTime) {
         };
 
         objectManager.FireProjectile(firePosition, playerRotation);
-        game.PlayShootSound();
+        game.QueueShootSound();
 
         if (hasRapid) {
             printf("Rapid fire shot! Remaining: %d\n", amountRapid);
@@ -162,12 +192,12 @@ void InputHandler::HandleGameInput(float deltaTime) {
     }
 
     // Use item
-    if (IsKeyPressed(KEY_LEFT_SHIFT)) {
+    if (input->IsKeyPressed(KEY_LEFT_SHIFT)) {
         UseItem();
     }
 
     // Return to main menu
-    if (IsKeyPressed(KEY_TAB)) {
+    if (input->IsKeyPressed(KEY_TAB)) {
         stateManager.SetState(MAIN_MENU);
     }
 }
@@ -179,12 +209,12 @@ void InputHandler::HandleGameInput(float deltaTime) {
  */
 void InputHandler::HandleGameOverInput() {
     // Return to main menu
-    if (IsKeyPressed(KEY_ENTER)) {
+    if (input->IsKeyPressed(KEY_ENTER)) {
         stateManager.SetState(MAIN_MENU);
     }
 
     // Alternative: ESC to quit
-    if (IsKeyPressed(KEY_ESCAPE)) {
+    if (input->IsKeyPressed(KEY_ESCAPE)) {
         game.SetGameRunning(false);
     }
 }
@@ -196,15 +226,15 @@ void InputHandler::HandleGameOverInput() {
  */
 void InputHandler::HandleOptionsInput() {
     // Navigation in controls
-    if (IsKeyPressed(KEY_UP) || IsKeyPressed(KEY_W)) {
+    if (input->IsKeyPressed(KEY_UP) || input->IsKeyPressed(KEY_W)) {
         // Scroll function could be implemented here
     }
-    else if (IsKeyPressed(KEY_DOWN) || IsKeyPressed(KEY_S)) {
+    else if (input->IsKeyPressed(KEY_DOWN) || input->IsKeyPressed(KEY_S)) {
         // Scroll function could be implemented here
     }
 
     // Return to main menu
-    if (IsKeyPressed(KEY_ENTER) || IsKeyPressed(KEY_ESCAPE)) {
+    if (input->IsKeyPressed(KEY_ENTER) || input->IsKeyPressed(KEY_ESCAPE)) {
         stateManager.SetState(MAIN_MENU);
     }
 }
@@ -216,8 +246,8 @@ void InputHandler::HandleOptionsInput() {
  */
 void InputHandler::HandleCreditsInput() {
     // Return to main menu on any key
-    if (IsKeyPressed(KEY_ENTER) || IsKeyPressed(KEY_ESCAPE) ||
-        IsKeyPressed(KEY_SPACE) || IsKeyPressed(KEY_BACKSPACE)) {
+    if (input->IsKeyPressed(KEY_ENTER) || input->IsKeyPressed(KEY_ESCAPE) ||
+        input->IsKeyPressed(KEY_SPACE) || input->IsKeyPressed(KEY_BACKSPACE)) {
         stateManager.SetState(MAIN_MENU);
     }
 }
@@ -233,7 +263,7 @@ void InputHandler::HandleNameEntryInput() {
 
     // Enter letters A-Z
     for (int key = KEY_A; key <= KEY_Z; key++) {
-        if (IsKeyPressed(key) && currentName.length() < 5) {
+        if (input->IsKeyPressed(key) && currentName.length() < 5) {
             char letter = 'A' + (key - KEY_A);
             currentName += letter;
             stateManager.SetPlayerName(currentName);
@@ -242,7 +272,7 @@ void InputHandler::HandleNameEntryInput() {
 
     // Enter numbers 0-9
     for (int key = KEY_ZERO; key <= KEY_NINE; key++) {
-        if (IsKeyPressed(key) && currentName.length() < 5) {
+        if (input->IsKeyPressed(key) && currentName.length() < 5) {
             char number = '0' + (key - KEY_ZERO);
             currentName += number;
             stateManager.SetPlayerName(currentName);
@@ -250,19 +280,19 @@ void InputHandler::HandleNameEntryInput() {
     }
 
     // Underscore and dash
-    if (IsKeyPressed(KEY_MINUS) && currentName.length() < 5) {
+    if (input->IsKeyPressed(KEY_MINUS) && currentName.length() < 5) {
         currentName += '_';
         stateManager.SetPlayerName(currentName);
     }
 
     // Backspace - delete last character
-    if (IsKeyPressed(KEY_BACKSPACE) && !currentName.empty()) {
+    if (input->IsKeyPressed(KEY_BACKSPACE) && !currentName.empty()) {
         currentName.pop_back();
         stateManager.SetPlayerName(currentName);
     }
 
     // Enter - confirm name (only if at least 1 character entered)
-    if (IsKeyPressed(KEY_ENTER) && stateManager.IsNameComplete()) {
+    if (input->IsKeyPressed(KEY_ENTER) && stateManager.IsNameComplete()) {
         // Pad name with underscores if shorter than 5 characters
         while (currentName.length() < 5) {
             currentName += '_';
@@ -275,7 +305,7 @@ void InputHandler::HandleNameEntryInput() {
     }
 
     // TAB - cancel (use default name)
-    if (IsKeyPressed(KEY_TAB)) {
+    if (input->IsKeyPressed(KEY_TAB)) {
         stateManager.SetPlayerName("ANON_");
         game.AddHighscoreEntry("ANON_", stateManager.GetNameEntryScore());
         stateManager.SetState(HIGHSCORE_DISPLAY);
@@ -287,7 +317,7 @@ void InputHandler::HandleNameEntryInput() {
  * Simple input handling that returns to main menu on ENTER or TAB
  */
 void InputHandler::HandleHighscoreDisplayInput() {
-    if (IsKeyPressed(KEY_ENTER) || IsKeyPressed(KEY_TAB)) {
+    if (input->IsKeyPressed(KEY_ENTER) || input->IsKeyPressed(KEY_TAB)) {
         stateManager.SetState(MAIN_MENU);
     }
 }
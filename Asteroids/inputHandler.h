@@ -3,6 +3,7 @@
 
 #include "gamestate.h"
 #include "objectmanager.h"
+#include "inputSource.h"
 
 class Game;
 class ObjectManager;
@@ -17,6 +18,8 @@ private:
     bool& hasRapid;                     // Reference to rapid fire status flag
     int& amountRapid;                   // Reference to remaining rapid fire shots
     bool& hasShield;                    // Reference to shield protection status
+    RaylibInputSource keyboardInput;    // Default input source reading the raylib keyboard
+    InputSource* input;                 // Active input source queried for key states
 
     void HandleMainMenuInput();
     void HandleOptionsInput();
@@ -36,7 +39,16 @@ public:
         int& rapidAmount /* Reference to remaining rapid fire shots */,
         bool& shield /* Reference to shield status */);
 
+    void BeginFrame();
+    void CaptureKeyboard();
+    void SetExternalKeyboardCapture(bool external /* True if the window thread calls CaptureKeyboard() */) {
+        keyboardInput.SetExternalCapture(external);
+    }
     void HandleInput(float deltaTime);
+    void SetInputSource(InputSource* source /* Input source to use, or nullptr for the keyboard */);
+    InputSource* GetInputSource() const {
+        return input;
+    }
 
 private:
     void UseItem();
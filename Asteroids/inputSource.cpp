@@ -0,0 +1,165 @@
+#include "inputSource.h"
+#include "raylib.h"
+
+/**
+ * Reads the raylib keyboard: queued key presses and the held state of every key
+ * Must run on the thread owning the window, once per rendered frame
+ * Presses pile up until NextFrame() takes them over
+ */
+void RaylibInputSource::Capture() {
+    std::lock_guard<std::mutex> lock(captureMutex);
+
+    int key = GetKeyPressed();
+    while (key != 0) {
+        if ((int)capturedPressed.size() < MAX_CAPTURED_PRESSES) {
+            capturedPressed.push_back(key);
+        }
+        key = GetKeyPressed();
+    }
+
+    for (int code = 0; code < KEY_STATE_COUNT; code++) {
+        capturedDown[code] = ::IsKeyDown(code);
+    }
+}
+
+/**
+ * Collects all key presses captured for the current frame
+ * Captures the keyboard itself unless the window thread does it
+ * Presses accumulate until the next tick consumes them
+ */
+void RaylibInputSource::NextFrame() {
+    if (!externalCapture) {
+        Capture();
+    }
+
+    std::lock_guard<std::mutex> lock(captureMutex);
+    pendingPressed.insert(pendingPressed.end(), capturedPressed.begin(), capturedPressed.end());
+    capturedPressed.clear();
+    frameDown = capturedDown;
+}
+
+/**
+ * Hands the collected presses to the starting tick
+ * Later ticks of the same frame see no presses
+ */
+void RaylibInputSource::NextTick() {
+    tickPressed.swap(pendingPressed);
+    pendingPressed.clear();
+}
+
+/**
+ * Checks whether a key is held during the current frame
+ * @param key Raylib key code
+ * @return True if the key was down at the frame's capture
+ */
+bool RaylibInputSource::IsKeyDown(int key) const {
+    return key >= 0 && key < KEY_STATE_COUNT && frameDown[key];
+}
+
+/**
+ * Checks whether a key was pressed since the previous tick
+ * @param key Raylib key code
+ * @return True if the key went down since the previous tick
+ */
+bool RaylibInputSource::IsKeyPressed(int key) const {
+    for (int pressed : tickPressed) {
+        if (pressed == key) return true;
+    }
+    return false;
+}
+
+/**
+ * Constructor for ScriptedInputSource
+ * Starts with an empty, non-looping script
+ */
+ScriptedInputSource::ScriptedInputSource() :
+    stepIndex(0),
+    stepTick(0),
+    looping(false),
+    started(false) {
+}
+
+/**
+ * Appends a step to the end of the script
+ * Steps with zero or negative duration are ignored
+ * @param ticks Duration of the step in ticks
+ * @param heldKeys Keys held during the whole step
+ * @param pressedKeys Keys pressed on the first tick of the step
+ */
+void ScriptedInputSource::AddStep(int ticks, const std::vector<int>& heldKeys,
+    const std::vector<int>& pressedKeys) {
+    if (ticks <= 0) return;
+    steps.push_back({ ticks, heldKeys, pressedKeys });
+}
+
+/**
+ * Restarts playback at the first step
+ */
+void ScriptedInputSource::Rewind() {
+    stepIndex = 0;
+    stepTick = 0;
+    started = false;
+}
+
+/**
+ * Checks whether a non-looping script has played all its steps
+ * @return True if no step is left to play
+ */
+bool ScriptedInputSource::IsFinished() const {
+    return stepIndex >= (int)steps.size();
+}
+
+/**
+ * Advances the script by one tick
+ * The first call starts the first step instead of advancing
+ */
+void ScriptedInputSource::NextTick() {
+    if (!started) {
+        started = true;
+        return;
+    }
+    if (IsFinished()) return;
+
+    stepTick++;
+    if (stepTick >= steps[stepIndex].ticks) {
+        stepTick = 0;
+        stepIndex++;
+        if (looping && IsFinished()) {
+            stepIndex = 0;
+        }
+    }
+}
+
+/**
+ * Checks whether the current step holds a key
+ * @param key Raylib key code
+ * @return True if the key is down in the current step
+ */
+bool ScriptedInputSource::IsKeyDown(int key) const {
+    if (IsFinished()) return false;
+    const Step& step = steps[stepIndex];
+    return Contains(step.heldKeys, key) || (stepTick == 0 && Contains(step.pressedKeys, key));
+}
+
+/**
+ * Checks whether the current step presses a key on this tick
+ * @param key Raylib key code
+ * @return True only on the first tick of a step listing the key
+ */
+bool ScriptedInputSource::IsKeyPressed(int key) const {
+    if (IsFinished()) return false;
+    return stepTick == 0 && Contains(steps[stepIndex].pressedKeys, key);
+}
+
+/**
+ * Linear search for a key in a small key list
+ * @param keys Key list to search
+ * @param key Key code to find
+ * @return True if the key is in the list
+ */
+bool ScriptedInputSource::Contains(const std::vector<int>& keys, int key) {
+    for (int k : keys) {
+        if (k == key) return true;
+    }
+    return false;
+}
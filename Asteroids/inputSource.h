@@ -0,0 +1,98 @@
+#ifndef INPUTSOURCE_H
+#define INPUTSOURCE_H
+
+#include <bitset>
+#include <mutex>
+#include <vector>
+
+/**
+ * InputSource interface abstracting keyboard queries
+ * Lets the input handler run against the real keyboard or against a script,
+ * so the simulation can be driven without a window
+ */
+class InputSource {
+public:
+    virtual ~InputSource() = default;
+
+    // Called once per rendered frame before the frame's simulation ticks
+    virtual void NextFrame() {}
+    // Called once per simulation tick before any key is queried
+    virtual void NextTick() {}
+    virtual bool IsKeyDown(int key /* Raylib key code */) const = 0;
+    virtual bool IsKeyPressed(int key /* Raylib key code */) const = 0;
+};
+
+/**
+ * RaylibInputSource reading the raylib keyboard state
+ * Default input source of the windowed game
+ * Key presses are collected once per frame and reported on the next tick only,
+ * so a frame running several fixed steps does not repeat a press and a
+ * frame running none does not lose it
+ * Capture() reads raylib and may run on the window thread while the ticks
+ * run on a simulation thread; NextFrame() then only takes over the capture
+ */
+class RaylibInputSource : public InputSource {
+private:
+    static const int KEY_STATE_COUNT = 512;     // Raylib keyboard key codes are below this
+    static const int MAX_CAPTURED_PRESSES = 64; // Presses kept while no frame consumes them
+
+    std::mutex captureMutex;                    // Guards the captured state between threads
+    std::vector<int> capturedPressed;           // Keys pressed since the last NextFrame()
+    std::bitset<KEY_STATE_COUNT> capturedDown;  // Keys held at the last capture
+    bool externalCapture = false;               // Capture() is called by the window thread
+    std::vector<int> pendingPressed;    // Keys pressed since the last tick
+    std::vector<int> tickPressed;       // Keys reported as pressed during the current tick
+    std::bitset<KEY_STATE_COUNT> frameDown;     // Keys held during the current frame
+
+public:
+    void Capture();
+    void SetExternalCapture(bool external /* True if the window thread calls Capture() */) {
+        externalCapture = external;
+    }
+
+    void NextFrame() override;
+    void NextTick() override;
+    bool IsKeyDown(int key) const override;
+    bool IsKeyPressed(int key) const override;
+};
+
+/**
+ * ScriptedInputSource replaying a fixed list of input steps
+ * Each step holds a set of keys for a number of ticks; pressed keys
+ * only report true on the first tick of their step
+ * Used by the headless target for soak tests and benchmarks
+ */
+class ScriptedInputSource : public InputSource {
+private:
+    struct Step {
+        int ticks;                      // Number of ticks the step lasts
+        std::vector<int> heldKeys;      // Keys reported as down for the whole step
+        std::vector<int> pressedKeys;   // Keys reported as pressed on the first tick
+    };
+
+    std::vector<Step> steps;    // Script in playback order
+    int stepIndex;              // Step currently being played
+    int stepTick;               // Ticks elapsed inside the current step
+    bool looping;               // Restart at the first step when the script ends
+    bool started;               // Whether NextTick has been called yet
+
+    static bool Contains(const std::vector<int>& keys, int key);
+
+public:
+    ScriptedInputSource();
+
+    void AddStep(int ticks /* Duration of the step in ticks */,
+        const std::vector<int>& heldKeys /* Keys held during the step */,
+        const std::vector<int>& pressedKeys = {} /* Keys pressed at step start */);
+    void SetLooping(bool loop) {
+        looping = loop;
+    }
+    void Rewind();
+    bool IsFinished() const;
+
+    void NextTick() override;
+    bool IsKeyDown(int key) const override;
+    bool IsKeyPressed(int key) const override;
+};
+
+#endif
@@ -0,0 +1,230 @@
+#include "integrationKernel.h"
+#include "globals.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define KERNEL_X86 1
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define KERNEL_TARGET_AVX2
+#else
+#define KERNEL_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+/**
+ * Detects the widest kernel the CPU and operating system support
+ * AVX2 additionally requires the OS to save YMM registers (XGETBV check)
+ * @return Best available kernel level
+ */
+static KernelLevel DetectLevel() {
+#if defined(KERNEL_X86) && defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    int maxLeaf = info[0];
+
+    __cpuid(info, 1);
+    bool hasSse2 = (info[3] & (1 << 26)) != 0;
+    bool hasOsxsave = (info[2] & (1 << 27)) != 0;
+    bool hasAvx = (info[2] & (1 << 28)) != 0;
+
+    if (hasOsxsave && hasAvx && maxLeaf >= 7 && (_xgetbv(0) & 0x6) == 0x6) {
+        __cpuidex(info, 7, 0);
+        if (info[1] & (1 << 5)) return KERNEL_AVX2;
+    }
+    return hasSse2 ? KERNEL_SSE2 : KERNEL_SCALAR;
+#elif defined(KERNEL_X86)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return KERNEL_AVX2;
+    if (__builtin_cpu_supports("sse2")) return KERNEL_SSE2;
+    return KERNEL_SCALAR;
+#else
+    return KERNEL_SCALAR;
+#endif
+}
+
+/**
+ * Returns the process-wide kernel selection, detected on first use
+ * @return Reference to the active kernel level
+ */
+static KernelLevel& ActiveLevel() {
+    static KernelLevel level = DetectLevel();
+    return level;
+}
+
+#ifdef KERNEL_X86
+/**
+ * SSE2 kernel: integrates and wraps 4 entities per iteration
+ * Wrapping uses compare masks and bitwise selects instead of branches
+ * Produces the same results as the scalar kernel bit for bit
+ */
+static void IntegrateAndWrapSse2(float* px, float* py, const float* vx, const float* vy,
+    const float* margin, int count, float deltaTime) {
+    const __m128 dt = _mm_set1_ps(deltaTime);
+    const __m128 width = _mm_set1_ps((float)SCREEN_WIDTH);
+    const __m128 height = _mm_set1_ps((float)SCREEN_HEIGHT);
+    const __m128 signBit = _mm_set1_ps(-0.0f);
+    __m128 m = _mm_setzero_ps();
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        if (margin) m = _mm_loadu_ps(margin + i);
+        __m128 low = _mm_xor_ps(m, signBit);    // -margin
+        __m128 highX = _mm_add_ps(width, m);
+        __m128 highY = _mm_add_ps(height, m);
+
+        __m128 x = _mm_add_ps(_mm_loadu_ps(px + i), _mm_mul_ps(_mm_loadu_ps(vx + i), dt));
+        __m128 y = _mm_add_ps(_mm_loadu_ps(py + i), _mm_mul_ps(_mm_loadu_ps(vy + i), dt));
+
+        __m128 mask = _mm_cmplt_ps(x, low);
+        x = _mm_or_ps(_mm_and_ps(mask, highX), _mm_andnot_ps(mask, x));
+        mask = _mm_cmpgt_ps(x, highX);
+        x = _mm_or_ps(_mm_and_ps(mask, low), _mm_andnot_ps(mask, x));
+
+        mask = _mm_cmplt_ps(y, low);
+        y = _mm_or_ps(_mm_and_ps(mask, highY), _mm_andnot_ps(mask, y));
+        mask = _mm_cmpgt_ps(y, highY);
+        y = _mm_or_ps(_mm_and_ps(mask, low), _mm_andnot_ps(mask, y));
+
+        _mm_storeu_ps(px + i, x);
+        _mm_storeu_ps(py + i, y);
+    }
+
+    // Remaining entities
+    IntegrationKernel::IntegrateAndWrapScalar(px + i, py + i, vx + i, vy + i,
+        margin ? margin + i : nullptr, count - i, deltaTime);
+}
+
+/**
+ * AVX2 kernel: integrates and wraps 8 entities per iteration
+ * Same branchless select scheme as the SSE2 kernel using blendv
+ */
+KERNEL_TARGET_AVX2
+static void IntegrateAndWrapAvx2(float* px, float* py, const float* vx, const float* vy,
+    const float* margin, int count, float deltaTime) {
+    const __m256 dt = _mm256_set1_ps(deltaTime);
+    const __m256 width = _mm256_set1_ps((float)SCREEN_WIDTH);
+    const __m256 height = _mm256_set1_ps((float)SCREEN_HEIGHT);
+    const __m256 signBit = _mm256_set1_ps(-0.0f);
+    __m256 m = _mm256_setzero_ps();
+
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        if (margin) m = _mm256_loadu_ps(margin + i);
+        __m256 low = _mm256_xor_ps(m, signBit);    // -margin
+        __m256 highX = _mm256_add_ps(width, m);
+        __m256 highY = _mm256_add_ps(height, m);
+
+        __m256 x = _mm256_add_ps(_mm256_loadu_ps(px + i), _mm256_mul_ps(_mm256_loadu_ps(vx + i), dt));
+        __m256 y = _mm256_add_ps(_mm256_loadu_ps(py + i), _mm256_mul_ps(_mm256_loadu_ps(vy + i), dt));
+
+        x = _mm256_blendv_ps(x, highX, _mm256_cmp_ps(x, low, _CMP_LT_OQ));
+        x = _mm256_blendv_ps(x, low, _mm256_cmp_ps(x, highX, _CMP_GT_OQ));
+        y = _mm256_blendv_ps(y, highY, _mm256_cmp_ps(y, low, _CMP_LT_OQ));
+        y = _mm256_blendv_ps(y, low, _mm256_cmp_ps(y, highY, _CMP_GT_OQ));
+
+        _mm256_storeu_ps(px + i, x);
+        _mm256_storeu_ps(py + i, y);
+    }
+
+    // Remaining entities
+    IntegrateAndWrapSse2(px + i, py + i, vx + i, vy + i,
+        margin ? margin + i : nullptr, count - i, deltaTime);
+}
+#endif
+
+namespace IntegrationKernel {
+
+    /**
+     * Integrates positions and wraps them around the screen for a batch of entities
+     * Entities that move past -margin reappear at SCREEN + margin and vice versa
+     * Dispatches to the widest kernel supported by the CPU
+     * @param px Position x array
+     * @param py Position y array
+     * @param vx Velocity x array
+     * @param vy Velocity y array
+     * @param margin Per-entity wrap margin, or nullptr for a margin of 0
+     * @param count Number of entities
+     * @param deltaTime Time step in seconds
+     */
+    void IntegrateAndWrap(float* px, float* py, const float* vx, const float* vy,
+        const float* margin, int count, float deltaTime) {
+        if (count <= 0) return;
+
+        switch (ActiveLevel()) {
+#ifdef KERNEL_X86
+        case KERNEL_AVX2:
+            IntegrateAndWrapAvx2(px, py, vx, vy, margin, count, deltaTime);
+            break;
+        case KERNEL_SSE2:
+            IntegrateAndWrapSse2(px, py, vx, vy, margin, count, deltaTime);
+            break;
+#endif
+        default:
+            IntegrateAndWrapScalar(px, py, vx, vy, margin, count, deltaTime);
+            break;
+        }
+    }
+
+    /**
+     * Portable reference implementation of IntegrateAndWrap
+     * Used as fallback, for the remainder of SIMD batches, and for verification
+     */
+    void IntegrateAndWrapScalar(float* px, float* py, const float* vx, const float* vy,
+        const float* margin, int count, float deltaTime) {
+        for (int i = 0; i < count; i++) {
+            float m = margin ? margin[i] : 0.0f;
+            float x = px[i] + vx[i] * deltaTime;
+            float y = py[i] + vy[i] * deltaTime;
+
+            x = (x < -m) ? SCREEN_WIDTH + m : x;
+            x = (x > SCREEN_WIDTH + m) ? -m : x;
+            y = (y < -m) ? SCREEN_HEIGHT + m : y;
+            y = (y > SCREEN_HEIGHT + m) ? -m : y;
+
+            px[i] = x;
+            py[i] = y;
+        }
+    }
+
+    /**
+     * Gets the widest kernel level the current CPU supports
+     * @return Detected kernel level
+     */
+    KernelLevel GetDetectedLevel() {
+        static KernelLevel detected = DetectLevel();
+        return detected;
+    }
+
+    /**
+     * Gets the kernel level currently used by IntegrateAndWrap
+     * @return Active kernel level
+     */
+    KernelLevel GetActiveLevel() {
+        return ActiveLevel();
+    }
+
+    /**
+     * Forces a kernel level, e.g. to compare against the scalar path
+     * Levels above what the CPU supports fall back to the detected level
+     * @param level Requested kernel level
+     */
+    void SetActiveLevel(KernelLevel level) {
+        KernelLevel detected = GetDetectedLevel();
+        ActiveLevel() = level > detected ? detected : level;
+    }
+
+    /**
+     * Returns a human-readable name of a kernel level
+     * @param level Kernel level to get the name for
+     * @return Const character pointer to the level name
+     */
+    const char* GetLevelName(KernelLevel level) {
+        switch (level) {
+        case KERNEL_SCALAR: return "Scalar";
+        case KERNEL_SSE2: return "SSE2";
+        case KERNEL_AVX2: return "AVX2";
+        default: return "Unknown";
+        }
+    }
+}
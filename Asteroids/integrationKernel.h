@@ -0,0 +1,31 @@
+#ifndef INTEGRATIONKERNEL_H
+#define INTEGRATIONKERNEL_H
+
+/**
+ * Instruction set used by the batch integration kernel
+ */
+enum KernelLevel {
+    KERNEL_SCALAR,   // Portable C++ loop, used on CPUs without SSE2 and as reference
+    KERNEL_SSE2,     // 4 entities per iteration
+    KERNEL_AVX2      // 8 entities per iteration
+};
+
+// Batch movement kernel shared by all structure-of-arrays entity stores
+namespace IntegrationKernel {
+    void IntegrateAndWrap(float* px /* Position x array */,
+        float* py /* Position y array */,
+        const float* vx /* Velocity x array */,
+        const float* vy /* Velocity y array */,
+        const float* margin /* Per-entity wrap margin, or nullptr for 0 */,
+        int count /* Number of entities */,
+        float deltaTime /* Time step in seconds */);
+    void IntegrateAndWrapScalar(float* px, float* py, const float* vx, const float* vy,
+        const float* margin, int count, float deltaTime);
+
+    KernelLevel GetDetectedLevel();
+    KernelLevel GetActiveLevel();
+    void SetActiveLevel(KernelLevel level /* Forced level, clamped to what the CPU supports */);
+    const char* GetLevelName(KernelLevel level /* Level to get name for */);
+}
+
+#endif
@@ -0,0 +1,168 @@
+#include "jobSystem.h"
+#include <algorithm>
+
+// Pool and queue owned by the current thread (nullptr / 0 outside any pool)
+static thread_local const JobSystem* currentPool = nullptr;
+static thread_local int currentQueue = 0;
+
+/**
+ * Constructor for JobSystem class
+ * Starts the pool threads; queue 0 is shared by all threads outside the pool
+ * @param workerCount Pool threads, -1 for one less than the hardware threads
+ */
+JobSystem::JobSystem(int workerCount) :
+    queuedTasks(0),
+    stopping(false) {
+    if (workerCount < 0) {
+        int hardwareThreads = static_cast<int>(std::thread::hardware_concurrency());
+        workerCount = std::max(0, hardwareThreads - 1);
+    }
+
+    for (int i = 0; i <= workerCount; i++) {
+        queues.push_back(std::unique_ptr<TaskQueue>(new TaskQueue()));
+    }
+    for (int i = 1; i <= workerCount; i++) {
+        workers.emplace_back(&JobSystem::WorkerLoop, this, i);
+    }
+}
+
+/**
+ * Destructor for JobSystem class
+ * Lets the workers finish queued tasks, then joins them
+ */
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping = true;
+    }
+    wakeWorkers.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+/**
+ * Gets the queue the calling thread pushes to and pops from
+ * @return Own queue index for pool threads, 0 for every other thread
+ */
+int JobSystem::GetQueueIndex() const {
+    return currentPool == this ? currentQueue : 0;
+}
+
+/**
+ * Runs one queued task if any is available
+ * Takes the newest task of the own queue, otherwise steals the oldest task
+ * of the next non-empty queue
+ * A throwing task still counts as finished; its exception is kept for the
+ * thread waiting in ParallelFor
+ * @param queueIndex Queue of the calling thread
+ * @return True if a task was run
+ */
+bool JobSystem::RunOneTask(int queueIndex) {
+    if (queuedTasks.load(std::memory_order_acquire) == 0) return false;
+
+    Task task;
+    bool found = false;
+    int queueCount = static_cast<int>(queues.size());
+
+    for (int offset = 0; offset < queueCount && !found; offset++) {
+        TaskQueue& queue = *queues[(queueIndex + offset) % queueCount];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.tasks.empty()) continue;
+
+        if (offset == 0) {
+            task = queue.tasks.back();
+            queue.tasks.pop_back();
+        }
+        else {
+            task = queue.tasks.front();
+            queue.tasks.pop_front();
+        }
+        found = true;
+    }
+    if (!found) return false;
+
+    queuedTasks.fetch_sub(1, std::memory_order_relaxed);
+    try {
+        (*task.body)(task.first, task.last);
+    }
+    catch (...) {
+        if (!task.group->failed.exchange(true)) {
+            task.group->error = std::current_exception();
+        }
+    }
+    task.group->remaining.fetch_sub(1, std::memory_order_release);
+    return true;
+}
+
+/**
+ * Main loop of a pool thread: run or steal tasks, sleep while there are none
+ * @param queueIndex Queue owned by this thread
+ */
+void JobSystem::WorkerLoop(int queueIndex) {
+    currentPool = this;
+    currentQueue = queueIndex;
+
+    while (true) {
+        if (RunOneTask(queueIndex)) continue;
+
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        wakeWorkers.wait(lock, [this] { return stopping || queuedTasks.load() > 0; });
+        if (stopping && queuedTasks.load() == 0) return;
+    }
+}
+
+/**
+ * Calls body on slices of [begin, end), spread over all pool threads
+ * Slices are multiples of 8 indices (one AVX2 batch) except the last one
+ * Ranges up to one grain, or a pool without workers, run inline
+ * Returns after every slice has finished; if slices threw, the first
+ * exception is rethrown on the calling thread
+ * @param begin First index
+ * @param end One past the last index
+ * @param grain Smallest slice worth handing to another thread
+ * @param body Called with [first, last) slices, possibly concurrently
+ */
+void JobSystem::ParallelFor(int begin, int end, int grain, const RangeFunction& body) {
+    int count = end - begin;
+    if (count <= 0) return;
+
+    int threadCount = GetThreadCount();
+    if (threadCount == 1 || count <= grain) {
+        body(begin, end);
+        return;
+    }
+
+    // A few slices per thread so stealing can even out uneven progress
+    int sliceCount = std::min((count + grain - 1) / grain, threadCount * 4);
+    int sliceSize = (count + sliceCount - 1) / sliceCount;
+    sliceSize = (sliceSize + 7) & ~7;
+    sliceCount = (count + sliceSize - 1) / sliceSize;
+
+    TaskGroup group;
+    group.remaining = sliceCount;
+    group.failed = false;
+    int queueIndex = GetQueueIndex();
+    {
+        TaskQueue& queue = *queues[queueIndex];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        for (int first = begin; first < end; first += sliceSize) {
+            queue.tasks.push_back({ &body, first, std::min(first + sliceSize, end), &group });
+        }
+    }
+    queuedTasks.fetch_add(sliceCount, std::memory_order_release);
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+    }
+    wakeWorkers.notify_all();
+
+    // Help out instead of blocking until all slices are done
+    while (group.remaining.load(std::memory_order_acquire) > 0) {
+        if (!RunOneTask(queueIndex)) {
+            std::this_thread::yield();
+        }
+    }
+    if (group.error) {
+        std::rethrow_exception(group.error);
+    }
+}
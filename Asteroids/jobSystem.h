@@ -0,0 +1,85 @@
+#ifndef JOBSYSTEM_H
+#define JOBSYSTEM_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * JobSystem class implementing a small work-stealing thread pool
+ * Every thread owns a task queue: it pops its own newest task first and
+ * steals the oldest task of another queue when its own runs dry
+ * The thread calling ParallelFor works on its own range while waiting, so
+ * nested ParallelFor calls from inside a task cannot deadlock
+ * An exception thrown by a slice is rethrown by ParallelFor once every
+ * slice has finished
+ *
+ * Usage:
+ *   jobs.ParallelFor(0, count, 1024, [&](int first, int last) { ...process [first, last)... });
+ */
+class JobSystem {
+public:
+    typedef std::function<void(int, int)> RangeFunction;
+
+private:
+    /**
+     * Completion state shared by the slices of one ParallelFor call
+     */
+    struct TaskGroup {
+        std::atomic<int> remaining;     // Unfinished slices
+        std::atomic<bool> failed;       // Set by the first slice that threw
+        std::exception_ptr error;       // Exception of that slice, read after the join
+    };
+
+    /**
+     * Contiguous slice of a ParallelFor range
+     */
+    struct Task {
+        const RangeFunction* body;      // Function processing the slice
+        int first;                      // First index of the slice
+        int last;                       // One past the last index
+        TaskGroup* group;               // Completion state of the owning ParallelFor
+    };
+
+    /**
+     * Task deque of one thread (index 0 is shared by all non-pool threads)
+     */
+    struct TaskQueue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    std::vector<std::unique_ptr<TaskQueue>> queues;    // One per worker, plus the external queue
+    std::vector<std::thread> workers;                   // Pool threads
+    std::mutex sleepMutex;                              // Guards sleeping workers
+    std::condition_variable wakeWorkers;                // Signalled when tasks are queued
+    std::atomic<int> queuedTasks;                       // Tasks waiting in any queue
+    bool stopping;                                      // Set by the destructor
+
+    int GetQueueIndex() const;
+    bool RunOneTask(int queueIndex);
+    void WorkerLoop(int queueIndex);
+
+public:
+    explicit JobSystem(int workerCount = -1 /* Pool threads, -1 = one less than the hardware threads */);
+    ~JobSystem();
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    void ParallelFor(int begin /* First index */,
+        int end /* One past the last index */,
+        int grain /* Smallest slice worth handing to another thread */,
+        const RangeFunction& body /* Called with [first, last) slices */);
+
+    int GetThreadCount() const {
+        return static_cast<int>(workers.size()) + 1;
+    }
+};
+
+#endif
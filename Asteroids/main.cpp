@@ -3,12 +3,40 @@
 #include "game.h"
 #include <iostream>
 #include <exception>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+
+/**
+ * Entry point of the windowed game
+ * --record FILE [--seed N] records the first session to a replay file,
+ * --replay FILE plays a recorded session back
+ */
+int main(int argc, char** argv) {
+    const char* recordPath = nullptr;
+    const char* replayPath = nullptr;
+    unsigned int seed = (unsigned int)time(nullptr);
+
+    for (int i = 1; i + 1 < argc; i++) {
+        if (strcmp(argv[i], "--record") == 0) recordPath = argv[++i];
+        else if (strcmp(argv[i], "--replay") == 0) replayPath = argv[++i];
+        else if (strcmp(argv[i], "--seed") == 0) seed = (unsigned int)strtoul(argv[++i], nullptr, 10);
+    }
 
-int main() {
     try {
         Game game;
         game.Initialize();
 
+        if (replayPath && !game.StartReplay(replayPath)) {
+            std::cerr << "Cannot load replay " << replayPath << std::endl;
+        }
+        else if (recordPath) {
+            game.StartRecordedGame(recordPath, seed);
+        }
+
+        // Simulation ticks on its own thread; this thread reads input and draws
+        game.StartSimulationThread();
+
         while (!WindowShouldClose() && game.IsGameRunning()) {
             try {
                 game.Update();
@@ -26,6 +54,7 @@ int main() {
             }
         }
 
+        game.StopSimulationThread();
         CloseWindow();
         return 0;
     }
@@ -0,0 +1,172 @@
+#include "narrowphase.h"
+#include <cmath>
+
+/**
+ * Squared distance from a point to a line segment
+ * @param point Point to measure from
+ * @param a Segment start
+ * @param b Segment end
+ * @return Squared distance to the closest point on the segment
+ */
+static float SegmentDistanceSquared(Vector2 point, Vector2 a, Vector2 b) {
+    float dx = b.x - a.x;
+    float dy = b.y - a.y;
+    float length = dx * dx + dy * dy;
+
+    float t = 0.0f;
+    if (length > 0.0f) {
+        t = ((point.x - a.x) * dx + (point.y - a.y) * dy) / length;
+        t = t < 0.0f ? 0.0f : (t > 1.0f ? 1.0f : t);
+    }
+
+    float cx = a.x + dx * t - point.x;
+    float cy = a.y + dy * t - point.y;
+    return cx * cx + cy * cy;
+}
+
+/**
+ * Signed doubled area of the triangle (a, b, p)
+ * Positive if p lies left of the edge a->b
+ */
+static float EdgeSide(Vector2 a, Vector2 b, Vector2 p) {
+    return (b.x - a.x) * (p.y - a.y) - (b.y - a.y) * (p.x - a.x);
+}
+
+namespace Narrowphase {
+
+    /**
+     * Checks whether two circles overlap
+     * @param centerA First circle center
+     * @param radiusA First circle radius
+     * @param centerB Second circle center
+     * @param radiusB Second circle radius
+     * @return True if the circles touch or overlap
+     */
+    bool CircleCircle(Vector2 centerA, float radiusA, Vector2 centerB, float radiusB) {
+        float dx = centerB.x - centerA.x;
+        float dy = centerB.y - centerA.y;
+        float reach = radiusA + radiusB;
+        return dx * dx + dy * dy <= reach * reach;
+    }
+
+    /**
+     * Checks whether a point lies inside a circle
+     * @param center Circle center
+     * @param radius Circle radius
+     * @param point Point to test
+     * @return True if the point is inside or on the circle
+     */
+    bool CirclePoint(Vector2 center, float radius, Vector2 point) {
+        float dx = point.x - center.x;
+        float dy = point.y - center.y;
+        return dx * dx + dy * dy <= radius * radius;
+    }
+
+    /**
+     * Checks whether a triangle and a circle overlap
+     * True if the circle center lies inside the triangle or any edge
+     * comes within the radius of the center; works for either winding
+     * @param triangle Triangle vertices
+     * @param center Circle center
+     * @param radius Circle radius
+     * @return True if the shapes touch or overlap
+     */
+    bool TriangleCircle(const Vector2 triangle[3], Vector2 center, float radius) {
+        float side0 = EdgeSide(triangle[0], triangle[1], center);
+        float side1 = EdgeSide(triangle[1], triangle[2], center);
+        float side2 = EdgeSide(triangle[2], triangle[0], center);
+
+        bool allLeft = side0 >= 0.0f && side1 >= 0.0f && side2 >= 0.0f;
+        bool allRight = side0 <= 0.0f && side1 <= 0.0f && side2 <= 0.0f;
+        if (allLeft || allRight) return true;
+
+        float radiusSquared = radius * radius;
+        return SegmentDistanceSquared(center, triangle[0], triangle[1]) <= radiusSquared ||
+            SegmentDistanceSquared(center, triangle[1], triangle[2]) <= radiusSquared ||
+            SegmentDistanceSquared(center, triangle[2], triangle[0]) <= radiusSquared;
+    }
+
+    /**
+     * Swept test of a moving point against a circle
+     * Finds the first parameter t in [0, 1] at which start + (end - start) * t
+     * lies within radius of the center
+     * @param start Segment start (position before the step)
+     * @param end Segment end (position after the step)
+     * @param center Circle center
+     * @param radius Combined radius of circle and moving object
+     * @param time Receives the hit parameter if the segment hits the circle
+     * @return True if the segment touches the circle
+     */
+    bool SweepSegmentCircle(Vector2 start, Vector2 end, Vector2 center, float radius, float& time) {
+        if (CirclePoint(center, radius, start)) {
+            time = 0.0f;    // Already overlapping at the start of the step
+            return true;
+        }
+
+        float dx = end.x - start.x;
+        float dy = end.y - start.y;
+        float fx = start.x - center.x;
+        float fy = start.y - center.y;
+
+        float a = dx * dx + dy * dy;
+        if (a <= 0.0f) return false;
+
+        float b = fx * dx + fy * dy;
+        if (b >= 0.0f) return false;    // Moving away from the circle
+
+        float c = fx * fx + fy * fy - radius * radius;
+        float discriminant = b * b - a * c;
+        if (discriminant < 0.0f) return false;
+
+        float t = (-b - sqrtf(discriminant)) / a;
+        if (t > 1.0f) return false;
+
+        time = t;
+        return true;
+    }
+
+    /**
+     * Tests a circle against every live candidate of an entity store
+     * @param center Circle center
+     * @param radius Circle radius
+     * @param store Store the candidate indices refer to
+     * @param candidates Slot indices from the broadphase
+     * @param hits Receives the overlapping slot indices in candidate order
+     * @return Number of hits
+     */
+    int CollectCircleHits(Vector2 center, float radius, const EntityStore& store,
+        const std::vector<int>& candidates, std::vector<int>& hits) {
+        hits.clear();
+        for (int index : candidates) {
+            if (!store.IsAlive(index)) continue;
+
+            Vector2 position = { store.px[index], store.py[index] };
+            if (CircleCircle(center, radius, position, store.radius[index])) {
+                hits.push_back(index);
+            }
+        }
+        return static_cast<int>(hits.size());
+    }
+
+    /**
+     * Tests a triangle against every live candidate of an entity store
+     * @param triangle Triangle vertices
+     * @param store Store the candidate indices refer to
+     * @param candidates Slot indices from the broadphase
+     * @param hits Receives the overlapping slot indices in candidate order
+     * @return Number of hits
+     */
+    int CollectTriangleHits(const Vector2 triangle[3], const EntityStore& store,
+        const std::vector<int>& candidates, std::vector<int>& hits) {
+        hits.clear();
+        for (int index : candidates) {
+            if (!store.IsAlive(index)) continue;
+
+            Vector2 position = { store.px[index], store.py[index] };
+            if (TriangleCircle(triangle, position, store.radius[index])) {
+                hits.push_back(index);
+            }
+        }
+        return static_cast<int>(hits.size());
+    }
+}
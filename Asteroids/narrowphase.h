@@ -0,0 +1,34 @@
+#ifndef NARROWPHASE_H
+#define NARROWPHASE_H
+
+#include <vector>
+#include "raylib.h"
+#include "entityStore.h"
+
+// Exact shape tests run on broadphase candidates
+// All tests compare squared distances and work on positions and radii directly
+namespace Narrowphase {
+    bool CircleCircle(Vector2 centerA /* First circle center */, float radiusA /* First circle radius */,
+        Vector2 centerB /* Second circle center */, float radiusB /* Second circle radius */);
+    bool CirclePoint(Vector2 center /* Circle center */, float radius /* Circle radius */,
+        Vector2 point /* Point to test */);
+    bool TriangleCircle(const Vector2 triangle[3] /* Triangle vertices */,
+        Vector2 center /* Circle center */, float radius /* Circle radius */);
+    bool SweepSegmentCircle(Vector2 start /* Segment start (position before the step) */,
+        Vector2 end /* Segment end (position after the step) */,
+        Vector2 center /* Circle center */,
+        float radius /* Combined radius of circle and moving object */,
+        float& time /* Receives the first hit parameter in [0, 1] */);
+
+    // Batch tests over broadphase candidates of an entity store (dead slots are skipped)
+    int CollectCircleHits(Vector2 center /* Circle center */, float radius /* Circle radius */,
+        const EntityStore& store /* Store the candidates index into */,
+        const std::vector<int>& candidates /* Slot indices from the broadphase */,
+        std::vector<int>& hits /* Output slot indices, cleared before filling */);
+    int CollectTriangleHits(const Vector2 triangle[3] /* Triangle vertices */,
+        const EntityStore& store /* Store the candidates index into */,
+        const std::vector<int>& candidates /* Slot indices from the broadphase */,
+        std::vector<int>& hits /* Output slot indices, cleared before filling */);
+}
+
+#endif
@@ -0,0 +1,268 @@
+#include "netTransport.h"
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#ifdef _MSC_VER
+#pragma comment(lib, "ws2_32.lib")
+#endif
+typedef SOCKET NativeSocket;
+typedef int SocketLength;
+#define CloseSocket closesocket
+#else
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+typedef int NativeSocket;
+typedef socklen_t SocketLength;
+#define CloseSocket close
+#endif
+
+namespace InputPackets {
+
+    /**
+     * Encodes a packet into its little-endian wire format
+     * @param packet Packet to encode
+     * @param out Receives INPUT_PACKET_SIZE bytes
+     */
+    void Encode(const InputPacket& packet, unsigned char* out) {
+        uint32_t words[2 + INPUT_PACKET_HISTORY] = { packet.player, packet.tick };
+        for (int i = 0; i < INPUT_PACKET_HISTORY; i++) {
+            words[2 + i] = packet.masks[i];
+        }
+        for (int word = 0; word < 2 + INPUT_PACKET_HISTORY; word++) {
+            for (int byte = 0; byte < 4; byte++) {
+                *out++ = (unsigned char)(words[word] >> (byte * 8));
+            }
+        }
+    }
+
+    /**
+     * Decodes a packet from its wire format
+     * @param in Received bytes
+     * @param size Number of received bytes
+     * @param packet Receives the decoded packet
+     * @return False if the datagram has the wrong size
+     */
+    bool Decode(const unsigned char* in, int size, InputPacket& packet) {
+        if (size != INPUT_PACKET_SIZE) return false;
+
+        uint32_t words[2 + INPUT_PACKET_HISTORY];
+        for (int word = 0; word < 2 + INPUT_PACKET_HISTORY; word++) {
+            words[word] = 0;
+            for (int byte = 0; byte < 4; byte++) {
+                words[word] |= (uint32_t)*in++ << (byte * 8);
+            }
+        }
+
+        packet.player = words[0];
+        packet.tick = words[1];
+        for (int i = 0; i < INPUT_PACKET_HISTORY; i++) {
+            packet.masks[i] = words[2 + i];
+        }
+        return true;
+    }
+}
+
+/**
+ * Constructor for InProcessNetwork class
+ * @param endpointCount Number of connected players
+ * @param latency Delay of every packet in network ticks (0 = next Take)
+ */
+InProcessNetwork::InProcessNetwork(int endpointCount, int latency) :
+    inboxes(endpointCount),
+    latencyTicks(latency),
+    clock(0) {
+}
+
+/**
+ * Queues a packet for every endpoint except the sender
+ * @param from Sending endpoint
+ * @param packet Packet to broadcast
+ */
+void InProcessNetwork::Post(int from, const InputPacket& packet) {
+    for (int endpoint = 0; endpoint < (int)inboxes.size(); endpoint++) {
+        if (endpoint == from) continue;
+        if (latencyTicks <= 0) {
+            inboxes[endpoint].push_back(packet);
+        }
+        else {
+            inFlight.push_back({ endpoint, clock + latencyTicks, packet });
+        }
+    }
+}
+
+/**
+ * Takes the oldest delivered packet of an endpoint
+ * @param endpoint Receiving endpoint
+ * @param packet Receives the packet
+ * @return False if nothing has arrived
+ */
+bool InProcessNetwork::Take(int endpoint, InputPacket& packet) {
+    std::deque<InputPacket>& inbox = inboxes[endpoint];
+    if (inbox.empty()) return false;
+
+    packet = inbox.front();
+    inbox.pop_front();
+    return true;
+}
+
+/**
+ * Advances the network by one tick and delivers the packets that are due
+ * Packets are delivered in the order they were sent
+ */
+void InProcessNetwork::Advance() {
+    clock++;
+
+    int kept = 0;
+    for (const Delivery& delivery : inFlight) {
+        if (delivery.deliverAt <= clock) {
+            inboxes[delivery.endpoint].push_back(delivery.packet);
+        }
+        else {
+            inFlight[kept++] = delivery;
+        }
+    }
+    inFlight.resize(kept);
+}
+
+/**
+ * Broadcasts a packet to all other players on the network
+ * @param packet Packet to send
+ */
+void InProcessTransport::Send(const InputPacket& packet) {
+    network.Post(endpoint, packet);
+}
+
+/**
+ * Takes the next packet delivered to this player
+ * @param packet Receives the packet
+ * @return False if nothing has arrived
+ */
+bool InProcessTransport::Receive(InputPacket& packet) {
+    return network.Take(endpoint, packet);
+}
+
+/**
+ * Constructor for UdpLoopbackTransport class
+ * Starts closed; Open() binds the socket
+ */
+UdpLoopbackTransport::UdpLoopbackTransport() :
+    socketHandle(-1) {
+}
+
+/**
+ * Destructor for UdpLoopbackTransport class
+ */
+UdpLoopbackTransport::~UdpLoopbackTransport() {
+    Close();
+}
+
+/**
+ * Builds a 127.0.0.1 socket address
+ * @param port Port in host byte order
+ * @return IPv4 loopback address with the port
+ */
+static sockaddr_in LoopbackAddress(int port) {
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_port = htons((unsigned short)port);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    return address;
+}
+
+/**
+ * Binds a non-blocking datagram socket to a loopback port
+ * @param localPort Port to receive on
+ * @param peers Ports of the other players
+ * @return False if the socket cannot be created or bound
+ */
+bool UdpLoopbackTransport::Open(int localPort, const std::vector<int>& peers) {
+    Close();
+
+#ifdef _WIN32
+    WSADATA wsaData;
+    if (WSAStartup(MAKEWORD(2, 2), &wsaData) != 0) return false;
+#endif
+
+    intptr_t handle = (intptr_t)socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    sockaddr_in address = LoopbackAddress(localPort);
+    bool ready = handle >= 0 && bind((NativeSocket)handle, (const sockaddr*)&address, sizeof(address)) == 0;
+
+#ifdef _WIN32
+    u_long nonBlocking = 1;
+    ready = ready && ioctlsocket((NativeSocket)handle, FIONBIO, &nonBlocking) == 0;
+#else
+    ready = ready && fcntl((NativeSocket)handle, F_SETFL, fcntl((NativeSocket)handle, F_GETFL, 0) | O_NONBLOCK) == 0;
+#endif
+
+    if (!ready) {
+        if (handle >= 0) CloseSocket((NativeSocket)handle);
+#ifdef _WIN32
+        WSACleanup();
+#endif
+        return false;
+    }
+
+    socketHandle = handle;
+    peerPorts = peers;
+    return true;
+}
+
+/**
+ * Closes the socket
+ */
+void UdpLoopbackTransport::Close() {
+    if (socketHandle == -1) return;
+
+    CloseSocket((NativeSocket)socketHandle);
+    socketHandle = -1;
+#ifdef _WIN32
+    WSACleanup();
+#endif
+}
+
+/**
+ * Sends a packet to every peer port as one datagram each
+ * Datagrams that cannot be sent are dropped; later packets repeat their input
+ * @param packet Packet to send
+ */
+void UdpLoopbackTransport::Send(const InputPacket& packet) {
+    if (socketHandle == -1) return;
+
+    unsigned char datagram[INPUT_PACKET_SIZE];
+    InputPackets::Encode(packet, datagram);
+    for (int port : peerPorts) {
+        sockaddr_in address = LoopbackAddress(port);
+        sendto((NativeSocket)socketHandle, (const char*)datagram, INPUT_PACKET_SIZE, 0,
+            (const sockaddr*)&address, sizeof(address));
+    }
+}
+
+/**
+ * Reads the next datagram without blocking
+ * Datagrams of the wrong size are skipped
+ * @param packet Receives the packet
+ * @return False if no valid datagram is waiting
+ */
+bool UdpLoopbackTransport::Receive(InputPacket& packet) {
+    if (socketHandle == -1) return false;
+
+    unsigned char datagram[INPUT_PACKET_SIZE + 1];
+    while (true) {
+        sockaddr_in sender;
+        SocketLength senderSize = sizeof(sender);
+        int size = (int)recvfrom((NativeSocket)socketHandle, (char*)datagram, sizeof(datagram), 0,
+            (sockaddr*)&sender, &senderSize);
+        if (size < 0) return false;
+        if (InputPackets::Decode(datagram, size, packet)) return true;
+    }
+}
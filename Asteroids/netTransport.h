@@ -0,0 +1,112 @@
+#ifndef NETTRANSPORT_H
+#define NETTRANSPORT_H
+
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#define INPUT_PACKET_HISTORY 4                              // Ticks of input repeated in every packet
+#define INPUT_PACKET_SIZE (8 + 4 * INPUT_PACKET_HISTORY)    // Encoded packet size in bytes
+
+/**
+ * One player's input for the newest tick plus the ticks before it
+ * Repeating older ticks lets a lost datagram be covered by the next one
+ */
+struct InputPacket {
+    uint32_t player;                        // Index of the sending player
+    uint32_t tick;                          // Tick of masks[0]; masks[i] belongs to tick - i
+    uint32_t masks[INPUT_PACKET_HISTORY];   // Replay key masks, newest first
+};
+
+// Little-endian wire format of input packets
+namespace InputPackets {
+    void Encode(const InputPacket& packet /* Packet to encode */,
+        unsigned char* out /* INPUT_PACKET_SIZE bytes */);
+    bool Decode(const unsigned char* in /* Received bytes */,
+        int size /* Number of received bytes */,
+        InputPacket& packet /* Receives the decoded packet */);
+}
+
+/**
+ * InputTransport interface carrying input packets between the players of a session
+ * Send() goes to every other player; Receive() never blocks
+ */
+class InputTransport {
+public:
+    virtual ~InputTransport() = default;
+
+    virtual void Send(const InputPacket& packet /* Packet for all other players */) = 0;
+    virtual bool Receive(InputPacket& packet /* Receives the next packet */) = 0;
+};
+
+/**
+ * InProcessNetwork connecting InProcessTransport endpoints without sockets
+ * Delivers every packet a fixed number of network ticks after it was sent,
+ * which lets tests provoke mispredictions deterministically
+ */
+class InProcessNetwork {
+private:
+    struct Delivery {
+        int endpoint;           // Receiving endpoint
+        int deliverAt;          // Network tick at which the packet arrives
+        InputPacket packet;     // Packet in flight
+    };
+
+    std::vector<Delivery> inFlight;             // Packets not delivered yet
+    std::vector<std::deque<InputPacket>> inboxes; // Delivered packets per endpoint
+    int latencyTicks;                           // Delay of every packet in network ticks
+    int clock;                                  // Current network tick
+
+public:
+    InProcessNetwork(int endpointCount /* Number of connected players */,
+        int latency /* Delay of every packet in network ticks */);
+
+    void Post(int from /* Sending endpoint */, const InputPacket& packet /* Packet to broadcast */);
+    bool Take(int endpoint /* Receiving endpoint */, InputPacket& packet /* Receives the packet */);
+    void Advance();
+};
+
+/**
+ * InProcessTransport attaching one player to an InProcessNetwork
+ */
+class InProcessTransport : public InputTransport {
+private:
+    InProcessNetwork& network;  // Network carrying the packets
+    int endpoint;               // Index of this player on the network
+
+public:
+    InProcessTransport(InProcessNetwork& net /* Network to attach to */,
+        int index /* Endpoint index of this player */) :
+        network(net),
+        endpoint(index) {
+    }
+
+    void Send(const InputPacket& packet) override;
+    bool Receive(InputPacket& packet) override;
+};
+
+/**
+ * UdpLoopbackTransport exchanging input packets as UDP datagrams on 127.0.0.1
+ * Each player binds its own port and sends to the ports of all others
+ */
+class UdpLoopbackTransport : public InputTransport {
+private:
+    intptr_t socketHandle;          // Non-blocking datagram socket, -1 while closed
+    std::vector<int> peerPorts;     // Ports of the other players
+
+public:
+    UdpLoopbackTransport();
+    ~UdpLoopbackTransport();
+    UdpLoopbackTransport(const UdpLoopbackTransport&) = delete;
+    UdpLoopbackTransport& operator=(const UdpLoopbackTransport&) = delete;
+
+    bool Open(int localPort /* Port to receive on */,
+        const std::vector<int>& peers /* Ports of the other players */);
+    void Close();
+    bool IsOpen() const { return socketHandle != -1; }
+
+    void Send(const InputPacket& packet) override;
+    bool Receive(InputPacket& packet) override;
+};
+
+#endif
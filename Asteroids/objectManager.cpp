@@ -1,37 +1,101 @@
 // objectmanager.cpp - With PowerUps
 #include "objectmanager.h"
 #include "globals.h"
+#include "jobSystem.h"
+#include "narrowphase.h"
+#include "profiler.h"
+#include "random.h"
+#include "simulationContext.h"
 #include <algorithm>
 #include <cstdlib>
 
+/**
+ * Removes all inactive objects from a pool in a single O(n) pass
+ * Uses the erase-remove idiom, which keeps the survivors in their original order
+ * Records live and reclaimed slot counts in the given statistics block
+ * @param pool Object vector to compact (element type must provide IsActive())
+ * @param stats Statistics block to update
+ */
+template <typename T>
+static void CompactPool(std::vector<T>& pool, PoolStats& stats) {
+    int sizeBefore = static_cast<int>(pool.size());
+
+    pool.erase(std::remove_if(pool.begin(), pool.end(),
+        [](const T& object) { return !object.IsActive(); }), pool.end());
+
+    stats.live = static_cast<int>(pool.size());
+    stats.dead = sizeBefore - stats.live;
+    stats.capacity = static_cast<int>(pool.capacity());
+    stats.peak = std::max(stats.peak, sizeBefore);
+}
+
+/**
+ * Removes all dead entities from a structure-of-arrays store in one O(n) pass
+ * Records live and reclaimed slot counts in the given statistics block
+ * @param store Entity store to compact (must provide Compact())
+ * @param stats Statistics block to update
+ */
+template <typename Store>
+static void CompactStore(Store& store, PoolStats& stats) {
+    int sizeBefore = store.size();
+
+    stats.dead = store.Compact();
+    stats.live = store.size();
+    stats.capacity = store.Capacity();
+    stats.peak = std::max(stats.peak, sizeBefore);
+}
+
 /**
  * Constructor for ObjectManager class
- * Initializes the object manager with a reference to the player spaceship
- * Pre-allocates memory for game objects to improve performance
- * @param ship Reference to the player's spaceship object
+ * Initializes the object manager with the ships of the session; a
+ * single-player game passes its one ship
+ * Pre-allocates memory for game objects and deferred commands
+ * @param sessionShips Ships of the session, the local player first
+ * @param count Number of ships
+ * @param simulationContext Random streams and difficulty of the session
  */
-ObjectManager::ObjectManager(Spaceship& ship) : player(ship), powerupSpawnTimer(0.0f) {
-    projectiles.reserve(50);
-    asteroids.reserve(20);
-    powerups.reserve(10);
+ObjectManager::ObjectManager(Spaceship* sessionShips, int count, SimulationContext& simulationContext) :
+    ships(sessionShips),
+    shipCount(count),
+    context(simulationContext),
+    projectileStats(),
+    asteroidStats(),
+    powerupStats(),
+    powerupSpawnTimer(0.0f),
+    spawnCount(0),
+    jobs(nullptr) {
+    projectiles.SetCapacity(PROJECTILE_CAPACITY);
+    asteroids.Reserve(ASTEROID_CAPACITY);
+    powerups.reserve(POWERUP_CAPACITY);
+    pendingCommands.reserve(COMMAND_CAPACITY);
 }
 
 /**
- * Updates all game objects and manages their lifecycle
- * Updates projectiles, asteroids, and power-ups each frame
- * Handles power-up spawning logic and removes inactive objects
- * Uses erase-remove idiom for efficient object cleanup
+ * Updates all game objects each frame
+ * Integrates the projectile and asteroid stores in bulk over their SoA arrays,
+ * updates power-ups and handles power-up spawning
+ * With a job system the stores are integrated in parallel slices; every
+ * entity is updated independently, so the result equals the serial path
+ * Inactive objects are removed later by CompactObjects() at the sync point
  * @param deltaTime Time elapsed since last frame in seconds
  */
 void ObjectManager::UpdateObjects(float deltaTime) {
-    // Update projectiles
-    for (auto& projectile : projectiles) {
-        projectile.Update(deltaTime);
+    PROFILE_SCOPE(ZONE_OBJECTS);
+
+    if (jobs) {
+        jobs->ParallelFor(0, projectiles.size(), PARALLEL_GRAIN, [&](int first, int last) {
+            projectiles.Integrate(first, last, deltaTime);
+        });
+        jobs->ParallelFor(0, asteroids.size(), PARALLEL_GRAIN, [&](int first, int last) {
+            asteroids.Integrate(first, last, deltaTime);
+        });
     }
+    else {
+        // Update projectiles
+        projectiles.Integrate(0, projectiles.size(), deltaTime);
 
-    // Update asteroids
-    for (auto& asteroid : asteroids) {
-        asteroid.Update(deltaTime);
+        // Update asteroids
+        asteroids.Integrate(0, asteroids.size(), deltaTime);
     }
 
     // Update power-ups
@@ -41,21 +105,6 @@ void ObjectManager::UpdateObjects(float deltaTime) {
 
     // Check power-up spawning
     CheckPowerUpSpawning(deltaTime);
-
-
-    // Remove inactive projectiles
-    for (int i = projectiles.size() - 1; i >= 0; i--) {
-        if (!projectiles[i].IsActive()) {
-            projectiles.erase(projectiles.begin() + i);
-        }
-    }
-
-    // Remove inactive power-ups
-    for (int i = powerups.size() - 1; i >= 0; i--) {
-        if (!powerups[i].IsActive()) {
-            powerups.erase(powerups.begin() + i);
-        }
-    }
 }
 
 /**
@@ -68,53 +117,73 @@ void ObjectManager::CheckPowerUpSpawning(float deltaTime) {
     powerupSpawnTimer += deltaTime;
 
     if (powerupSpawnTimer >= POWERUP_SPAWN_INTERVAL) {
+        RandomGenerator& random = context.GetRandom(RANDOM_POWERUPS);
+
         // Spawn at random position on screen (not at edges)
         Vector2 spawnPos = {
-            static_cast<float>(GetRandomValue(100, SCREEN_WIDTH - 100)),
-            static_cast<float>(GetRandomValue(100, SCREEN_HEIGHT - 100))
+            static_cast<float>(random.Range(100, SCREEN_WIDTH - 100)),
+            static_cast<float>(random.Range(100, SCREEN_HEIGHT - 100))
         };
 
         // Random power-up type
-        PowerUpType randomType = static_cast<PowerUpType>(GetRandomValue(0, 2));
+        PowerUpType randomType = static_cast<PowerUpType>(random.Range(0, 2));
         SpawnPowerUp(spawnPos, randomType);
         powerupSpawnTimer = 0.0f;
     }
 }
 
 /**
- * Creates and spawns a new power-up at the specified location
- * Adds the power-up to the active power-ups collection
+ * Collects the first active power-up touching a ship
+ * Tests the ship triangle against each power-up's pickup circle and
+ * deactivates the power-up it finds; at most one is collected per call
+ * @param ship Index of the collecting ship
+ * @param type Receives the type of the collected power-up
+ * @return True if a power-up was collected
+ */
+bool ObjectManager::CollectPowerUp(int ship, PowerUpType& type) {
+    if (ship < 0 || ship >= shipCount) return false;
+
+    const Vector2* triangle = ships[ship].GetTrianglePoints();
+    for (PowerUp& powerup : powerups) {
+        if (!powerup.IsActive()) continue;
+        if (Narrowphase::TriangleCircle(triangle, powerup.GetPosition(), powerup.GetRadius())) {
+            type = powerup.GetType();
+            powerup.Collect();
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Queues a new power-up at the specified location
+ * The power-up is created at the next ApplyPendingCommands() call
  * @param position 2D vector position where the power-up should spawn
  * @param type Type of power-up to create (EXTRA_LIFE, RAPID_FIRE, SHIELD)
  */
 void ObjectManager::SpawnPowerUp(Vector2 position, PowerUpType type) {
-    PowerUp newPowerUp;
-    newPowerUp.Spawn(position, type);
-    powerups.push_back(newPowerUp);
+    ObjectCommand command = {};
+    command.type = SPAWN_POWERUP_COMMAND;
+    command.position = position;
+    command.powerUpType = type;
+    pendingCommands.push_back(command);
 }
 
 /**
  * Creates and fires a projectile from the specified position and rotation
- * Reuses inactive projectiles for performance, creates new ones if needed
- * Enforces maximum projectile limit to prevent memory issues
+ * Takes a slot from the projectile pool in O(1); the shot is dropped if
+ * the pool is full (see SetProjectileCapacity)
  * @param position Starting position for the projectile
  * @param rotation Direction angle for the projectile's movement
+ * @return Handle of the new projectile, invalid if the shot was dropped
  */
-void ObjectManager::FireProjectile(Vector2 position, float rotation) {
-    // Find free projectile or add new one
-    for (auto& projectile : projectiles) {
-        if (!projectile.IsActive()) {
-            projectile.Fire(position, rotation);
-            return;
-        }
-    }
+ProjectileHandle ObjectManager::FireProjectile(Vector2 position, float rotation) {
+    int index = projectiles.Add();
+    if (index < 0) return ProjectileHandle();
 
-    // If no free projectile found, add new one
-    if (projectiles.size() < 50) { // Limit
-        Projectile newProjectile;
-        newProjectile.Fire(position, rotation);
-        projectiles.push_back(newProjectile);
-    }
+    projectiles[index].Fire(position, rotation);
+    spawnCount++;
+    return projectiles.GetHandle(index);
 }
 
 /**
@@ -129,15 +198,91 @@ void ObjectManager::SpawnAsteroids(int count) {
 }
 
 /**
- * Creates and spawns a single asteroid at the specified position and size
- * Adds the asteroid to the active asteroids collection
+ * Queues a single asteroid at the specified position and size
+ * The asteroid is created at the next ApplyPendingCommands() call,
+ * so callers may spawn while the asteroid vector is being iterated
  * @param position 2D vector position where the asteroid should spawn
  * @param size Size category of the asteroid (LARGE, MEDIUM, SMALL)
  */
 void ObjectManager::SpawnAsteroid(Vector2 position, AsteroidSize size) {
-    Asteroid newAsteroid;
-    newAsteroid.Spawn(position, size);
-    asteroids.push_back(newAsteroid);
+    ObjectCommand command = {};
+    command.type = SPAWN_ASTEROID_COMMAND;
+    command.position = position;
+    command.asteroidSize = size;
+    pendingCommands.push_back(command);
+}
+
+/**
+ * Queues the destruction of the asteroid at the given index
+ * The asteroid stays in place until the next ApplyPendingCommands() call
+ * @param index Index of the asteroid in the asteroid collection
+ */
+void ObjectManager::DestroyAsteroid(int index) {
+    ObjectCommand command = {};
+    command.type = DESTROY_ASTEROID_COMMAND;
+    command.index = index;
+    pendingCommands.push_back(command);
+}
+
+/**
+ * Applies all queued spawns and destroys in recording order, then compacts
+ * This is the frame's sync point - no object vector may be iterated while it runs
+ * Grows the object vectors once for the whole batch so no reallocation
+ * happens in the middle of a frame
+ */
+void ObjectManager::ApplyPendingCommands() {
+    size_t asteroidSpawns = 0;
+    size_t powerupSpawns = 0;
+    for (const ObjectCommand& command : pendingCommands) {
+        if (command.type == SPAWN_ASTEROID_COMMAND) asteroidSpawns++;
+        else if (command.type == SPAWN_POWERUP_COMMAND) powerupSpawns++;
+    }
+
+    int asteroidsNeeded = asteroids.size() + static_cast<int>(asteroidSpawns);
+    if (asteroidsNeeded > asteroids.Capacity()) {
+        asteroids.Reserve(std::max(asteroids.Capacity() * 2, asteroidsNeeded));
+    }
+    if (powerups.size() + powerupSpawns > powerups.capacity()) {
+        powerups.reserve(std::max(powerups.capacity() * 2, powerups.size() + powerupSpawns));
+    }
+
+    for (const ObjectCommand& command : pendingCommands) {
+        switch (command.type) {
+        case SPAWN_ASTEROID_COMMAND: {
+            asteroids[asteroids.Add()].Spawn(command.position, command.asteroidSize,
+                context.GetAsteroidSpeedMultiplier(), context.GetRandom(RANDOM_ASTEROIDS));
+            break;
+        }
+        case DESTROY_ASTEROID_COMMAND:
+            if (command.index >= 0 && command.index < asteroids.size()) {
+                asteroids[command.index].Destroy();
+            }
+            break;
+        case SPAWN_POWERUP_COMMAND: {
+            PowerUp newPowerUp;
+            newPowerUp.Spawn(command.position, command.powerUpType);
+            powerups.push_back(newPowerUp);
+            break;
+        }
+        }
+    }
+
+    pendingCommands.clear();
+    spawnCount += static_cast<int>(asteroidSpawns + powerupSpawns);
+
+    CompactObjects();
+}
+
+/**
+ * Removes inactive projectiles, asteroids, and power-ups
+ * One linear pass per pool keeps every vector bounded by the number of
+ * live objects, so update, draw and collision never walk dead slots
+ * Indices into the pools are invalidated, which is why it only runs at the sync point
+ */
+void ObjectManager::CompactObjects() {
+    CompactStore(projectiles, projectileStats);
+    CompactStore(asteroids, asteroidStats);
+    CompactPool(powerups, powerupStats);
 }
 
 /**
@@ -147,25 +292,26 @@ void ObjectManager::SpawnAsteroid(Vector2 position, AsteroidSize size) {
  * @return Vector2 position coordinates for spawning
  */
 Vector2 ObjectManager::GetRandomEdgePosition() {
-    int edge = GetRandomValue(0, 3); // 0=top, 1=right, 2=bottom, 3=left
+    RandomGenerator& random = context.GetRandom(RANDOM_SPAWNS);
+    int edge = random.Range(0, 3); // 0=top, 1=right, 2=bottom, 3=left
     Vector2 position;
 
     switch (edge) {
     case 0: // Top
-        position.x = static_cast<float>(GetRandomValue(0, SCREEN_WIDTH));
+        position.x = static_cast<float>(random.Range(0, SCREEN_WIDTH));
         position.y = -50.0f;
         break;
     case 1: // Right
         position.x = SCREEN_WIDTH + 50.0f;
-        position.y = static_cast<float>(GetRandomValue(0, SCREEN_HEIGHT));
+        position.y = static_cast<float>(random.Range(0, SCREEN_HEIGHT));
         break;
     case 2: // Bottom
-        position.x = static_cast<float>(GetRandomValue(0, SCREEN_WIDTH));
+        position.x = static_cast<float>(random.Range(0, SCREEN_WIDTH));
         position.y = SCREEN_HEIGHT + 50.0f;
         break;
     case 3: // Left
         position.x = -50.0f;
-        position.y = static_cast<float>(GetRandomValue(0, SCREEN_HEIGHT));
+        position.y = static_cast<float>(random.Range(0, SCREEN_HEIGHT));
         break;
     }
 
@@ -181,5 +327,30 @@ void ObjectManager::ResetObjects() {
     projectiles.clear();
     asteroids.clear();
     powerups.clear();
+    pendingCommands.clear();
     powerupSpawnTimer = 0.0f;
+    projectileStats = PoolStats();
+    asteroidStats = PoolStats();
+    powerupStats = PoolStats();
+}
+
+/**
+ * Captures the bookkeeping that lives outside the object vectors
+ * @return Spawn timer, spawn count and pool statistics
+ */
+ObjectManagerState ObjectManager::GetState() const {
+    return { powerupSpawnTimer, spawnCount, projectileStats, asteroidStats, powerupStats };
+}
+
+/**
+ * Restores bookkeeping captured by GetState()
+ * The object vectors are restored separately by the caller
+ * @param state State saved by GetState()
+ */
+void ObjectManager::SetState(const ObjectManagerState& state) {
+    powerupSpawnTimer = state.powerupSpawnTimer;
+    spawnCount = state.spawnCount;
+    projectileStats = state.projectileStats;
+    asteroidStats = state.asteroidStats;
+    powerupStats = state.powerupStats;
 }
\ No newline at end of file
@@ -8,49 +8,151 @@
 #include "asteroid.h"
 #include "powerup.h"
 
+class JobSystem;
+class SimulationContext;
+
+/**
+ * Kinds of structural changes that are deferred until the frame's sync point
+ */
+enum ObjectCommandType {
+    SPAWN_ASTEROID_COMMAND,     // Append a new asteroid
+    DESTROY_ASTEROID_COMMAND,   // Deactivate the asteroid at the given index
+    SPAWN_POWERUP_COMMAND       // Append a new power-up
+};
+
+/**
+ * Deferred object command recorded during update and collision
+ * Applied in recording order by ObjectManager::ApplyPendingCommands()
+ */
+struct ObjectCommand {
+    ObjectCommandType type;     // Kind of change to apply
+    Vector2 position;           // Spawn position (spawn commands only)
+    AsteroidSize asteroidSize;  // Size of the new asteroid (SPAWN_ASTEROID_COMMAND only)
+    PowerUpType powerUpType;    // Type of the new power-up (SPAWN_POWERUP_COMMAND only)
+    int index;                  // Target asteroid index (DESTROY_ASTEROID_COMMAND only)
+};
+
+/**
+ * Slot usage of one object pool, sampled at the last sync point
+ */
+struct PoolStats {
+    int live;           // Active objects kept after compaction
+    int dead;           // Inactive slots reclaimed by the last compaction
+    int capacity;       // Allocated slots in the underlying vector
+    int peak;           // Largest size seen before compaction since the last reset
+};
+
+/**
+ * Object manager bookkeeping outside the object vectors, for world snapshots
+ */
+struct ObjectManagerState {
+    float powerupSpawnTimer;    // Timer for automatic power-up spawning
+    int spawnCount;             // Objects spawned or fired since construction
+    PoolStats projectileStats;  // Projectile slot usage at the last sync point
+    PoolStats asteroidStats;    // Asteroid slot usage at the last sync point
+    PoolStats powerupStats;     // Power-up slot usage at the last sync point
+};
+
 class ObjectManager {
 private:
-    Spaceship& player;                         // Reference to player spaceship
-    std::vector<Projectile> projectiles;       // Collection of all active projectiles
-    std::vector<Asteroid> asteroids;           // Collection of all active asteroids
+    Spaceship* ships;                          // Ships of the session, the local player first
+    int shipCount;                             // Number of ships
+    SimulationContext& context;                // Random streams and difficulty of the session
+    ProjectileStore projectiles;               // Structure-of-arrays store of all projectiles
+    AsteroidStore asteroids;                   // Structure-of-arrays store of all asteroids
     std::vector<PowerUp> powerups;             // Collection of all active power-ups
+    std::vector<ObjectCommand> pendingCommands; // Spawns and destroys waiting for the sync point
+    PoolStats projectileStats;                 // Projectile slot usage at the last sync point
+    PoolStats asteroidStats;                   // Asteroid slot usage at the last sync point
+    PoolStats powerupStats;                    // Power-up slot usage at the last sync point
     float powerupSpawnTimer;                   // Timer for automatic power-up spawning
+    int spawnCount;                            // Objects spawned or fired since construction (never reset)
+    JobSystem* jobs;                           // Pool for the bulk integration (nullptr = serial)
     const float POWERUP_SPAWN_INTERVAL = 15.0f; // Spawn interval in seconds (every 15 seconds)
+    static const int PROJECTILE_CAPACITY = 128; // Default projectile pool size (4 ships on rapid fire)
+    static const int ASTEROID_CAPACITY = 256;   // Asteroids reserved up front
+    static const int POWERUP_CAPACITY = 16;     // Power-ups reserved up front
+    static const int COMMAND_CAPACITY = 128;    // Deferred commands reserved up front
 
 public:
-    ObjectManager(Spaceship& ship /* Reference to player spaceship */);
+    ObjectManager(Spaceship* sessionShips /* Ships of the session, the local player first */,
+        int count /* Number of ships */,
+        SimulationContext& simulationContext /* Random streams and difficulty of the session */);
 
     void UpdateObjects(float deltaTime);
+    // Only pays off for fields of many PARALLEL_GRAIN entities (--bench-parallel);
+    // game sessions stay serial
+    void SetJobSystem(JobSystem* jobSystem /* Pool to integrate on, or nullptr for serial */) {
+        jobs = jobSystem;
+    }
     void ResetObjects();
 
-    // Spawning
+    // Deferred commands
+    void ApplyPendingCommands();
+    void DestroyAsteroid(int index /* Index of the asteroid to deactivate */);
+    bool HasPendingCommands() const {
+        return !pendingCommands.empty();
+    }
+    void CompactObjects();
+
+    // Spawning (asteroids and power-ups are queued until ApplyPendingCommands)
     void SpawnAsteroids(int count /* Number of asteroids to spawn */);
     void SpawnAsteroid(Vector2 position /* Spawn position coordinates */,
         AsteroidSize size /* Size category (LARGE, MEDIUM, SMALL) */);
-    void FireProjectile(Vector2 position /* Starting position for projectile */,
+    ProjectileHandle FireProjectile(Vector2 position /* Starting position for projectile */,
         float rotation /* Direction angle in degrees */);
+    void SetProjectileCapacity(int capacity /* Projectiles the pool holds */) {
+        projectiles.SetCapacity(capacity);
+    }
     void SpawnPowerUp(Vector2 position /* Spawn position coordinates */,
         PowerUpType type /* Type of power-up to create */);
     void CheckPowerUpSpawning(float deltaTime /* Time elapsed since last frame in seconds */);
+    bool CollectPowerUp(int ship /* Index of the collecting ship */,
+        PowerUpType& type /* Receives the type of the collected power-up */);
     Vector2 GetRandomEdgePosition();
 
     // Getters
-    Spaceship& GetPlayer() { return player; }
-    const std::vector<Projectile>& GetProjectiles() const { 
+    Spaceship& GetPlayer() { return ships[0]; }
+    SimulationContext& GetContext() { return context; }
+    const ProjectileStore& GetProjectiles() const { 
         return projectiles;
     }
-    const std::vector<Asteroid>& GetAsteroids() const {
+    const AsteroidStore& GetAsteroids() const {
         return asteroids;
     }
     const std::vector<PowerUp>& GetPowerUps() const {
         return powerups;
     }
 
+    // Pool statistics
+    const PoolStats& GetProjectileStats() const {
+        return projectileStats;
+    }
+    const PoolStats& GetAsteroidStats() const {
+        return asteroidStats;
+    }
+    const PoolStats& GetPowerUpStats() const {
+        return powerupStats;
+    }
+    int GetSpawnCount() const {
+        return spawnCount;
+    }
+
+    // World snapshots
+    ObjectManagerState GetState() const;
+    void SetState(const ObjectManagerState& state /* State saved by GetState */);
+    const std::vector<ObjectCommand>& GetPendingCommands() const {
+        return pendingCommands;
+    }
+    std::vector<ObjectCommand>& GetPendingCommandsMutable() {
+        return pendingCommands;
+    }
+
     // Mutable Getters (if needed)
-    std::vector<Projectile>& GetProjectilesMutable() {
+    ProjectileStore& GetProjectilesMutable() {
         return projectiles;
     }
-    std::vector<Asteroid>& GetAsteroidsMutable() {
+    AsteroidStore& GetAsteroidsMutable() {
         return asteroids; 
     }
     std::vector<PowerUp>& GetPowerUpsMutable() { 
@@ -95,4 +95,12 @@ void PowerUp::Draw() const {
  */
 Rectangle PowerUp::GetBounds() const {
     return { position.x - 25, position.y - 10, 50, 20 };
+}
+
+/**
+ * Returns the pickup radius used by the circle narrowphase
+ * @return Radius in pixels around the power-up center
+ */
+float PowerUp::GetRadius() const {
+    return POWERUP_RADIUS;
 }
\ No newline at end of file
@@ -35,6 +35,7 @@ public:
         return type; 
     }
     Rectangle GetBounds() const;
+    float GetRadius() const;
     void Collect() {
         active = false;
     }
@@ -0,0 +1,151 @@
+#include "profiler.h"
+#include <algorithm>
+#include <mutex>
+
+// Accumulated time of the frame in progress
+// Samples may come from the simulation thread while the window thread ends frames
+static float currentFrame[PROFILE_ZONE_COUNT] = {};
+static std::mutex currentFrameMutex;
+
+// Ring buffer of finished frames, one row per zone
+static float history[PROFILE_ZONE_COUNT][PROFILE_HISTORY] = {};
+static int historyHead = 0;         // Slot the next finished frame is written to
+static int historyCount = 0;        // Number of valid frames in the ring buffer
+
+static std::chrono::steady_clock::time_point lastFrameEnd = std::chrono::steady_clock::now();
+static bool overlayVisible = false;
+
+// Whether PROFILE_SCOPE records on this thread; off unless the thread opts in
+static thread_local bool threadEnabled = false;
+
+namespace Profiler {
+
+    /**
+     * Enables or disables zone recording for the calling thread
+     * Game enables its window and simulation threads; server pool threads
+     * stay disabled so their sessions share no profiler state
+     * @param enabled Whether the calling thread records zones
+     */
+    void SetThreadEnabled(bool enabled) {
+        threadEnabled = enabled;
+    }
+
+    /**
+     * Checks whether the calling thread records zones
+     * @return True if SetThreadEnabled(true) was called on this thread
+     */
+    bool IsThreadEnabled() {
+        return threadEnabled;
+    }
+
+    /**
+     * Adds measured time to a zone of the current frame
+     * @param zone Zone the time belongs to
+     * @param milliseconds Measured duration
+     */
+    void AddSample(ProfileZone zone, float milliseconds) {
+        std::lock_guard<std::mutex> lock(currentFrameMutex);
+        currentFrame[zone] += milliseconds;
+    }
+
+    /**
+     * Closes the current frame and pushes its zone times into the ring buffer
+     * Also records the wall time since the previous call as ZONE_FRAME
+     * and places a frame marker in the trace file
+     */
+    void EndFrame() {
+        auto now = std::chrono::steady_clock::now();
+        std::chrono::duration<float, std::milli> frameTime = now - lastFrameEnd;
+        lastFrameEnd = now;
+        std::lock_guard<std::mutex> lock(currentFrameMutex);
+        currentFrame[ZONE_FRAME] = frameTime.count();
+
+        for (int zone = 0; zone < PROFILE_ZONE_COUNT; zone++) {
+            history[zone][historyHead] = currentFrame[zone];
+            currentFrame[zone] = 0.0f;
+        }
+
+        historyHead = (historyHead + 1) % PROFILE_HISTORY;
+        if (historyCount < PROFILE_HISTORY) historyCount++;
+
+        Trace::Instant("Frame");
+    }
+
+    /**
+     * Discards all recorded frames
+     */
+    void Reset() {
+        std::lock_guard<std::mutex> lock(currentFrameMutex);
+        std::fill(&currentFrame[0], &currentFrame[0] + PROFILE_ZONE_COUNT, 0.0f);
+        historyHead = 0;
+        historyCount = 0;
+        lastFrameEnd = std::chrono::steady_clock::now();
+    }
+
+    /**
+     * Summarizes a zone over the frames in the ring buffer
+     * @param zone Zone to summarize
+     * @return Last, average, 99th percentile and maximum milliseconds
+     */
+    ZoneStats GetStats(ProfileZone zone) {
+        ZoneStats stats = { 0.0f, 0.0f, 0.0f, 0.0f };
+        if (historyCount == 0) return stats;
+
+        float sorted[PROFILE_HISTORY];
+        float sum = 0.0f;
+        for (int i = 0; i < historyCount; i++) {
+            sorted[i] = history[zone][i];
+            sum += sorted[i];
+            stats.max = std::max(stats.max, sorted[i]);
+        }
+
+        int p99Index = (historyCount * 99 + 99) / 100 - 1;
+        std::nth_element(sorted, sorted + p99Index, sorted + historyCount);
+
+        stats.last = history[zone][(historyHead + PROFILE_HISTORY - 1) % PROFILE_HISTORY];
+        stats.average = sum / historyCount;
+        stats.p99 = sorted[p99Index];
+        return stats;
+    }
+
+    /**
+     * Gets the number of frames currently held in the ring buffer
+     * @return Frame count, at most PROFILE_HISTORY
+     */
+    int GetFrameCount() {
+        return historyCount;
+    }
+
+    /**
+     * Returns a human-readable name of a zone
+     * @param zone Zone to get the name for
+     * @return Const character pointer to the zone name
+     */
+    const char* GetZoneName(ProfileZone zone) {
+        switch (zone) {
+        case ZONE_FRAME: return "Frame";
+        case ZONE_UPDATE: return "Update";
+        case ZONE_TICK: return "Tick";
+        case ZONE_INPUT: return "Input";
+        case ZONE_OBJECTS: return "Objects";
+        case ZONE_COLLISIONS: return "Collisions";
+        case ZONE_DRAW: return "Draw";
+        default: return "Unknown";
+        }
+    }
+
+    /**
+     * Checks whether the on-screen profiler overlay is shown
+     * @return True if the overlay is visible
+     */
+    bool IsOverlayVisible() {
+        return overlayVisible;
+    }
+
+    /**
+     * Shows or hides the on-screen profiler overlay
+     */
+    void ToggleOverlay() {
+        overlayVisible = !overlayVisible;
+    }
+}
@@ -0,0 +1,97 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include "trace.h"
+#include <chrono>
+
+// Set to 0 to compile every PROFILE_SCOPE out of the build
+#ifndef ENABLE_PROFILER
+#define ENABLE_PROFILER 1
+#endif
+
+#define PROFILE_HISTORY 240   // Frames kept in the ring buffer (4 seconds at 60 FPS)
+
+/**
+ * Timed regions of a frame
+ */
+enum ProfileZone {
+    ZONE_FRAME,         // Wall time between two EndFrame() calls
+    ZONE_UPDATE,        // Game::Update, all simulation steps of the frame
+    ZONE_TICK,          // Game::Tick, one simulation step
+    ZONE_INPUT,         // InputHandler::HandleInput
+    ZONE_OBJECTS,       // ObjectManager::UpdateObjects
+    ZONE_COLLISIONS,    // CollisionSystem::CheckCollisions
+    ZONE_DRAW,          // UIRenderer::DrawCurrentState
+    PROFILE_ZONE_COUNT
+};
+
+/**
+ * Timing summary of one zone over the frames in the ring buffer
+ */
+struct ZoneStats {
+    float last;         // Milliseconds in the most recent frame
+    float average;      // Mean milliseconds per frame
+    float p99;          // 99th percentile milliseconds per frame
+    float max;          // Slowest frame in milliseconds
+};
+
+// Per-frame zone timings; a zone entered several times per frame is summed
+// Only threads enabled with SetThreadEnabled record anything, so sessions
+// stepped on pool threads never meet on the shared frame
+namespace Profiler {
+    void SetThreadEnabled(bool enabled /* Whether the calling thread records zones */);
+    bool IsThreadEnabled();
+    void AddSample(ProfileZone zone /* Zone the time belongs to */,
+        float milliseconds /* Measured duration */);
+    void EndFrame();
+    void Reset();
+
+    ZoneStats GetStats(ProfileZone zone /* Zone to summarize */);
+    int GetFrameCount();
+    const char* GetZoneName(ProfileZone zone /* Zone to get name for */);
+
+    bool IsOverlayVisible();
+    void ToggleOverlay();
+}
+
+/**
+ * RAII timer adding the lifetime of the object to a zone
+ * Also emits the zone to the trace file while a trace session is running
+ * Does nothing on threads the profiler is not enabled for
+ * Use through PROFILE_SCOPE so it disappears when the profiler is disabled
+ */
+class ProfileScope {
+private:
+    ProfileZone zone;                                   // Zone receiving the sample
+    bool enabled;                                       // Whether the constructing thread records zones
+    std::chrono::steady_clock::time_point start;        // Construction time
+
+public:
+    explicit ProfileScope(ProfileZone zone /* Zone to time */) :
+        zone(zone),
+        enabled(Profiler::IsThreadEnabled()),
+        start(enabled ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point()) {
+    }
+    ~ProfileScope() {
+        if (!enabled) return;
+        std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+        std::chrono::duration<float, std::milli> elapsed = end - start;
+        Profiler::AddSample(zone, elapsed.count());
+        if (Trace::IsActive()) {
+            Trace::Zone(Profiler::GetZoneName(zone), start, end);
+        }
+    }
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+};
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+
+#if ENABLE_PROFILER
+#define PROFILE_SCOPE(zone) ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(zone)
+#else
+#define PROFILE_SCOPE(zone) ((void)0)
+#endif
+
+#endif
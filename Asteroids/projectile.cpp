@@ -1,17 +1,218 @@
 #include "projectile.h"
 #include "globals.h"
+#include "integrationKernel.h"
 #include <cmath>
 
 /**
- * Default constructor for Projectile class
- * Initializes all member variables to default inactive state
- * Sets position, velocity, lifetime, and active status to safe defaults
+ * Appends an empty (dead) projectile slot and gives it a handle
+ * Takes the first handle slot of the free list; the arrays were reserved
+ * by SetCapacity(), so nothing is allocated
+ * @return Index of the new slot, -1 if the pool is full
  */
-Projectile::Projectile() {
-    position = { 0.0f, 0.0f };
-    velocity = { 0.0f, 0.0f };
-    lifetime = 0.0f;
-    active = false;
+int ProjectileStore::Add() {
+    if (freeHead < 0) return -1;
+
+    int slot = freeHead;
+    freeHead = nextFree[slot];
+
+    int index = AddHot();
+    handleSlots.push_back(slot);
+    handleTargets[slot] = index;
+    return index;
+}
+
+/**
+ * Puts a handle slot back on the free list
+ * Bumping the generation makes every handle issued for it stale
+ * @param slot Handle slot to release
+ */
+void ProjectileStore::ReleaseHandle(int slot) {
+    generations[slot]++;
+    handleTargets[slot] = -1;
+    nextFree[slot] = freeHead;
+    freeHead = slot;
+}
+
+/**
+ * Integrates position and lifetime for a range of projectiles
+ * Position update and screen wrapping run through the batch SIMD kernel
+ * Projectiles whose lifetime runs out become dead and are removed by Compact()
+ * @param first First slot to update
+ * @param last One past the last slot to update
+ * @param deltaTime Time step in seconds
+ */
+void ProjectileStore::Integrate(int first, int last, float deltaTime) {
+    if (last <= first) return;
+
+    SavePreviousPositions(first, last);
+
+    // Update position with screen wrapping at the screen edges (no margin)
+    IntegrationKernel::IntegrateAndWrap(px.data() + first, py.data() + first,
+        vx.data() + first, vy.data() + first, nullptr,
+        last - first, deltaTime);
+
+    for (int i = first; i < last; i++) {
+        lifetime[i] -= deltaTime;
+    }
+}
+
+/**
+ * Removes expired projectiles in a single stable O(n) pass
+ * Survivors keep their relative order and their handles; slot indices are
+ * invalidated. Handle slots of expired projectiles return to the free list
+ * @return Number of slots reclaimed
+ */
+int ProjectileStore::Compact() {
+    int count = size();
+    int write = 0;
+
+    for (int read = 0; read < count; read++) {
+        if (!IsAlive(read)) {
+            ReleaseHandle(handleSlots[read]);
+            continue;
+        }
+
+        if (write != read) {
+            MoveHot(read, write);
+            handleSlots[write] = handleSlots[read];
+            handleTargets[handleSlots[write]] = write;
+        }
+        write++;
+    }
+
+    ResizeHot(write);
+    handleSlots.resize(write);
+    return count - write;
+}
+
+/**
+ * Sets how many projectiles the pool holds and allocates all arrays for it
+ * Live projectiles and their handles are kept; new handle slots join the
+ * free list
+ * @param capacity Projectiles the pool holds (never below the current count)
+ */
+void ProjectileStore::SetCapacity(int capacity) {
+    capacity = capacity > size() ? capacity : size();
+    ReserveHot(capacity);
+    handleSlots.reserve(capacity);
+
+    int oldCapacity = GetPoolCapacity();
+    if (capacity > oldCapacity) {
+        generations.resize(capacity, 0);
+        handleTargets.resize(capacity, -1);
+        nextFree.resize(capacity, -1);
+        for (int slot = capacity - 1; slot >= oldCapacity; slot--) {
+            nextFree[slot] = freeHead;
+            freeHead = slot;
+        }
+    }
+    else if (capacity < oldCapacity) {
+        // Shrinking renumbers the handles of the survivors
+        generations.resize(capacity);
+        handleTargets.resize(capacity);
+        nextFree.resize(capacity);
+        ResetHandles();
+    }
+}
+
+/**
+ * Removes all projectiles while keeping allocated capacity
+ * Every handle becomes stale
+ */
+void ProjectileStore::clear() {
+    for (int index = 0; index < size(); index++) {
+        ReleaseHandle(handleSlots[index]);
+    }
+    ResizeHot(0);
+    handleSlots.clear();
+}
+
+/**
+ * Hands out fresh handles for the current slots, e.g. after a world
+ * snapshot overwrote the arrays
+ * Slot i gets handle slot i; every previously issued handle becomes stale.
+ * Grows the pool if the arrays hold more projectiles than it has room for
+ */
+void ProjectileStore::ResetHandles() {
+    int count = size();
+    if (count > GetPoolCapacity()) {
+        generations.resize(count, 0);
+        handleTargets.resize(count, -1);
+        nextFree.resize(count, -1);
+    }
+
+    handleSlots.resize(count);
+    freeHead = -1;
+    for (int slot = GetPoolCapacity() - 1; slot >= 0; slot--) {
+        generations[slot]++;
+        if (slot < count) {
+            handleTargets[slot] = slot;
+            handleSlots[slot] = slot;
+        }
+        else {
+            handleTargets[slot] = -1;
+            nextFree[slot] = freeHead;
+            freeHead = slot;
+        }
+    }
+}
+
+/**
+ * Gets the handle of the projectile in a slot
+ * @param index Slot index
+ * @return Handle that stays valid until the projectile expires
+ */
+ProjectileHandle ProjectileStore::GetHandle(int index) const {
+    ProjectileHandle handle;
+    handle.slot = handleSlots[index];
+    handle.generation = generations[handle.slot];
+    return handle;
+}
+
+/**
+ * Looks up the slot a handle refers to
+ * @param handle Handle to look up
+ * @return Slot index, -1 if the projectile was reclaimed since the handle was issued
+ *         (a projectile that expired this step is still found until Compact())
+ */
+int ProjectileStore::Resolve(ProjectileHandle handle) const {
+    if (handle.slot < 0 || handle.slot >= GetPoolCapacity()) return -1;
+    if (generations[handle.slot] != handle.generation) return -1;
+    return handleTargets[handle.slot];
+}
+
+/**
+ * Returns a view onto the projectile in the given slot
+ * @param index Slot index
+ * @return Projectile view bound to this store
+ */
+Projectile ProjectileStore::operator[](int index) {
+    return Projectile(this, index);
+}
+
+/**
+ * Returns a read-only view onto the projectile in the given slot
+ * @param index Slot index
+ * @return Const projectile view bound to this store
+ */
+ConstProjectile ProjectileStore::operator[](int index) const {
+    return ConstProjectile(this, index);
+}
+
+/**
+ * Constructor for the read-only projectile view
+ * @param owner Store holding the projectile data
+ * @param slot Slot index inside the store
+ */
+ConstProjectile::ConstProjectile(const ProjectileStore* owner, int slot) : store(owner), index(slot) {
+}
+
+/**
+ * Constructor for the Projectile view
+ * @param owner Store holding the projectile data
+ * @param slot Slot index inside the store
+ */
+Projectile::Projectile(ProjectileStore* owner, int slot) : ConstProjectile(owner, slot), writableStore(owner) {
 }
 
 /**
@@ -22,38 +223,27 @@ Projectile::Projectile() {
  * @param rotation Direction angle in degrees for projectile movement
  */
 void Projectile::Fire(Vector2 startPos, float rotation) {
-    position = startPos;
     float radians = rotation * WINKEL2GRAD;
-    velocity.x = cosf(radians) * PROJECTILE_SPEED;
-    velocity.y = sinf(radians) * PROJECTILE_SPEED;
-    lifetime = PROJECTILE_LIFETIME;
-    active = true;
+    writableStore->px[index] = startPos.x;
+    writableStore->py[index] = startPos.y;
+    writableStore->prevPx[index] = startPos.x;
+    writableStore->prevPy[index] = startPos.y;
+    writableStore->vx[index] = cosf(radians) * PROJECTILE_SPEED;
+    writableStore->vy[index] = sinf(radians) * PROJECTILE_SPEED;
+    writableStore->radius[index] = 2.0f;
+    writableStore->lifetime[index] = PROJECTILE_LIFETIME;
 }
 
 /**
- * Updates the projectile's position and state each frame
- * Moves projectile based on velocity, decrements lifetime
- * Handles screen wrapping - projectiles reappear on opposite side
- * Deactivates projectile when lifetime expires
+ * Updates this projectile's position and lifetime
+ * Single-entity path; ObjectManager integrates the whole store at once
  * Only processes updates if the projectile is active
  * @param deltaTime Time elapsed since last frame in seconds
  */
 void Projectile::Update(float deltaTime) {
-    if (!active) return;
+    if (!IsActive()) return;
 
-    position.x += velocity.x * deltaTime;
-    position.y += velocity.y * deltaTime;
-    lifetime -= deltaTime;
-
-    // Screen wrapping - projectiles wrap around screen edges
-    if (position.x < 0) position.x = SCREEN_WIDTH;
-    if (position.x > SCREEN_WIDTH) position.x = 0;
-    if (position.y < 0) position.y = SCREEN_HEIGHT;
-    if (position.y > SCREEN_HEIGHT) position.y = 0;
-
-    if (lifetime <= 0) {
-        active = false;
-    }
+    writableStore->Integrate(index, index + 1, deltaTime);
 }
 
 /**
@@ -62,9 +252,12 @@ void Projectile::Update(float deltaTime) {
  * Creates a elongated shape (4x12 pixels) for better visibility
  * Aligns the projectile vertically relative to its movement direction
  * Only renders if the projectile is active
+ * @param alpha Interpolation factor between the last two simulation steps
  */
-void Projectile::Draw() const {
-    if (!active) return;
+void ConstProjectile::Draw(float alpha) const {
+    if (!IsActive()) return;
+
+    Vector2 position = store->GetRenderPosition(index, alpha);
 
     // Black rectangle
     Rectangle rect = {
@@ -75,7 +268,7 @@ void Projectile::Draw() const {
     };
 
     // Orientation aligned with movement direction
-    float angle = atan2f(velocity.y, velocity.x) * RAD2DEG + 90.0f; // +90° for vertical alignment
+    float angle = atan2f(store->vy[index], store->vx[index]) * RAD2DEG + 90.0f; // +90° for vertical alignment
 
     DrawRectanglePro(
         rect,
@@ -91,6 +284,7 @@ void Projectile::Draw() const {
  * Uses 4x4 pixel dimensions for precise collision detection
  * @return Rectangle representing the projectile's collision bounds
  */
-Rectangle Projectile::GetBounds() const {
-    return { position.x - 2, position.y - 2, 4, 4 };
+Rectangle ConstProjectile::GetBounds() const {
+    float radius = store->radius[index];
+    return { store->px[index] - radius, store->py[index] - radius, radius * 2, radius * 2 };
 }
\ No newline at end of file
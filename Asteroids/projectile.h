@@ -2,32 +2,115 @@
 #define PROJECTILE_H
 
 #include "raylib.h"
+#include "entityStore.h"
+#include <cstdint>
+#include <vector>
 
-class Projectile {
+class Projectile;
+class ConstProjectile;
+
+/**
+ * Generational reference to a pooled projectile
+ * Unlike a slot index it survives compaction; once the projectile has
+ * expired and its handle slot is reused, the generation no longer matches
+ * and the handle resolves to nothing
+ */
+struct ProjectileHandle {
+    int slot = -1;              // Handle slot inside the pool (-1 = no projectile)
+    uint32_t generation = 0;    // Generation of the handle slot when the handle was issued
+
+    bool IsValid() const {
+        return slot >= 0;
+    }
+};
+
+/**
+ * ProjectileStore class holding all projectiles in structure-of-arrays layout
+ * All projectile state is hot, so it uses the EntityStore arrays only
+ * A projectile is alive while its lifetime is above zero
+ *
+ * The store is a fixed-capacity pool: SetCapacity() allocates every array
+ * once, Add() takes a handle slot from an intrusive free list in O(1), and
+ * Compact() returns the slots of expired projectiles to it. Firing and
+ * expiring never touch the heap
+ */
+class ProjectileStore : public EntityStore {
 private:
-    Vector2 position;       // Current x,y coordinates of projectile center
-    Vector2 velocity;       // Movement speed and direction (pixels per second)
-    float lifetime;         // Remaining time in seconds before projectile expires
-    bool active;            // Whether projectile is alive and should be processed
+    std::vector<uint32_t> generations;  // Current generation per handle slot
+    std::vector<int> handleTargets;     // Store index per handle slot (-1 = free)
+    std::vector<int> nextFree;          // Free list link per handle slot (-1 = end)
+    std::vector<int> handleSlots;       // Handle slot per store index
+    int freeHead = -1;                  // First free handle slot (-1 = pool full)
+
+    void ReleaseHandle(int slot /* Handle slot to put back on the free list */);
 
 public:
-    Projectile();
+    int Add();
+    void Integrate(int first /* First slot to update */,
+        int last /* One past the last slot to update */,
+        float deltaTime /* Time step in seconds */);
+    int Compact();
+    void SetCapacity(int capacity /* Projectiles the pool holds (never below the current count) */);
+    int GetPoolCapacity() const {
+        return static_cast<int>(generations.size());
+    }
+    bool IsFull() const {
+        return freeHead < 0;
+    }
+    void clear();
+    void ResetHandles();
 
-    void Fire(Vector2 startPos /* Starting position coordinates */,
-        float rotation /* Direction angle in degrees */);
-    void Update(float deltaTime);
-    void Draw() const;
+    ProjectileHandle GetHandle(int index /* Slot index */) const;
+    int Resolve(ProjectileHandle handle /* Handle to look up */) const;
+
+    Projectile operator[](int index /* Slot index */);
+    ConstProjectile operator[](int index /* Slot index */) const;
+};
+
+/**
+ * ConstProjectile class giving read-only access to one shot
+ * Returned by a const ProjectileStore, so a const store cannot be changed
+ * through a copy of the view; Projectile adds the mutating calls
+ */
+class ConstProjectile {
+protected:
+    const ProjectileStore* store;   // Store holding the projectile data
+    int index;                      // Slot index inside the store
+
+public:
+    ConstProjectile(const ProjectileStore* owner /* Store holding the projectile data */,
+        int slot /* Slot index inside the store */);
+
+    void Draw(float alpha = 1.0f /* Interpolation factor between the last two steps */) const;
 
     bool IsActive() const {
-        return active;
+        return store->IsAlive(index);
     }
     Vector2 GetPosition() const {
-        return position;
+        return { store->px[index], store->py[index] };
     }
     Rectangle GetBounds() const;
+};
+
+/**
+ * Projectile class representing a single shot
+ * Lightweight view onto one slot of a ProjectileStore - cheap to copy,
+ * valid until the store is compacted or grows
+ */
+class Projectile : public ConstProjectile {
+private:
+    ProjectileStore* writableStore; // Same store as the base view, writable
+
+public:
+    Projectile(ProjectileStore* owner /* Store holding the projectile data */,
+        int slot /* Slot index inside the store */);
+
+    void Fire(Vector2 startPos /* Starting position coordinates */,
+        float rotation /* Direction angle in degrees */);
+    void Update(float deltaTime);
     void Deactivate() {
-        active = false;
+        writableStore->lifetime[index] = 0.0f;
     }
 };
 
-#endif
\ No newline at end of file
+#endif
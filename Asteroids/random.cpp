@@ -0,0 +1,113 @@
+#include "random.h"
+
+/**
+ * SplitMix64 step, used to expand a seed into well-mixed generator state
+ * @param x Running SplitMix64 state
+ * @return Next 64-bit output
+ */
+static uint64_t SplitMix64(uint64_t& x) {
+    uint64_t z = (x += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+/**
+ * Rotates a 32-bit value left
+ */
+static inline uint32_t RotateLeft(uint32_t x, int k) {
+    return (x << k) | (x >> (32 - k));
+}
+
+/**
+ * Default constructor - seeds with 0
+ */
+RandomGenerator::RandomGenerator() {
+    Seed(0);
+}
+
+/**
+ * Constructor seeding the generator
+ * @param seed Seed, expanded with SplitMix64
+ */
+RandomGenerator::RandomGenerator(uint64_t seed) {
+    Seed(seed);
+}
+
+/**
+ * Resets the generator to the sequence of a seed
+ * SplitMix64 never yields an all-zero state from consecutive outputs
+ * @param seed Seed value
+ */
+void RandomGenerator::Seed(uint64_t seed) {
+    uint64_t a = SplitMix64(seed);
+    uint64_t b = SplitMix64(seed);
+    state[0] = (uint32_t)a;
+    state[1] = (uint32_t)(a >> 32);
+    state[2] = (uint32_t)b;
+    state[3] = (uint32_t)(b >> 32);
+}
+
+/**
+ * Produces the next 32 random bits
+ * @return Uniformly distributed 32-bit value
+ */
+uint32_t RandomGenerator::Next() {
+    uint32_t result = RotateLeft(state[1] * 5, 7) * 9;
+    uint32_t t = state[1] << 9;
+
+    state[2] ^= state[0];
+    state[3] ^= state[1];
+    state[1] ^= state[2];
+    state[0] ^= state[3];
+    state[2] ^= t;
+    state[3] = RotateLeft(state[3], 11);
+    return result;
+}
+
+/**
+ * Random integer in an inclusive range, like GetRandomValue(min, max)
+ * Maps 32 bits with a multiply-shift instead of a modulo
+ * @param min Lowest value
+ * @param max Highest value (inclusive)
+ * @return Value in [min, max]
+ */
+int RandomGenerator::Range(int min, int max) {
+    if (max < min) {
+        int swap = min;
+        min = max;
+        max = swap;
+    }
+    uint64_t span = (uint64_t)((int64_t)max - (int64_t)min) + 1;
+    return (int)((int64_t)min + (int64_t)(((uint64_t)Next() * span) >> 32));
+}
+
+/**
+ * Random float in [0, 1) with 24 bits of precision
+ * @return Uniformly distributed float
+ */
+float RandomGenerator::NextFloat() {
+    return (float)(Next() >> 8) * (1.0f / 16777216.0f);
+}
+
+/**
+ * Random float in [min, max)
+ * @param min Lowest value
+ * @param max Upper bound (exclusive)
+ * @return Uniformly distributed float
+ */
+float RandomGenerator::Range(float min, float max) {
+    return min + (max - min) * NextFloat();
+}
+
+/**
+ * Combines a session seed and a channel into one 64-bit seed
+ * Every (seed, channel) pair starts its own, unrelated sequence
+ * @param seed Session seed
+ * @param channel Random channel
+ * @return Seed for a RandomGenerator
+ */
+uint64_t DeriveStreamSeed(uint32_t seed, uint32_t channel) {
+    uint64_t mixed = ((uint64_t)seed << 32) ^ ((uint64_t)channel << 24) ^ 0xFFFFFFFFu;
+    return SplitMix64(mixed);
+}
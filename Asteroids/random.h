@@ -0,0 +1,53 @@
+#ifndef RANDOM_H
+#define RANDOM_H
+
+#include <cstdint>
+
+/**
+ * Independent random streams, one per consumer
+ * Drawing from one stream never changes the numbers another stream produces,
+ * so e.g. cosmetic effects cannot disturb the simulation
+ */
+enum RandomChannel {
+    RANDOM_ASTEROIDS,   // Asteroid speed, heading, spin and color
+    RANDOM_SPAWNS,      // Spawn positions of asteroid waves
+    RANDOM_POWERUPS,    // Timed power-up spawns and asteroid drops
+    RANDOM_EFFECTS,     // Visual jitter and particles (not part of the simulation)
+    RANDOM_CHANNEL_COUNT
+};
+
+/**
+ * RandomGenerator class implementing xoshiro128**
+ * 128 bits of state, period 2^128 - 1, a handful of ALU ops per number
+ * Not synchronized - every thread must use its own generator
+ */
+class RandomGenerator {
+private:
+    uint32_t state[4];      // Generator state, never all zero
+
+public:
+    RandomGenerator();
+    explicit RandomGenerator(uint64_t seed /* Seed, expanded with SplitMix64 */);
+
+    void Seed(uint64_t seed /* Seed, expanded with SplitMix64 */);
+    uint32_t Next();
+    int Range(int min /* Lowest value */, int max /* Highest value (inclusive) */);
+    float NextFloat();
+    float Range(float min /* Lowest value */, float max /* Upper bound (exclusive) */);
+};
+
+/**
+ * Saved position of the simulation streams, for world snapshots
+ * RANDOM_EFFECTS is left out: it is drawn by the renderer, not the simulation
+ * The streams themselves live in each session's SimulationContext
+ */
+struct RandomStreamState {
+    uint32_t seed;                              // Session seed of the streams
+    RandomGenerator streams[RANDOM_EFFECTS];    // Every channel before RANDOM_EFFECTS
+};
+
+// Seed of one stream of a session (see SimulationContext)
+uint64_t DeriveStreamSeed(uint32_t seed /* Session seed */,
+    uint32_t channel /* Random channel */);
+
+#endif
@@ -0,0 +1,60 @@
+#include "renderSnapshot.h"
+#include "globals.h"
+
+/**
+ * Computes the blend factor between the snapshot's last two simulation steps
+ * Adds the time that passed since publishing to the unsimulated remainder,
+ * so a renderer running faster than the simulation keeps moving smoothly
+ * @param now Render time
+ * @return 0 = previous step, 1 = current step
+ */
+float RenderSnapshot::GetInterpolationAlpha(std::chrono::steady_clock::time_point now) const {
+    float sincePublish = std::chrono::duration<float>(now - publishTime).count();
+    float alpha = (stepRemainder + SafeMax(0.0f, sincePublish)) / FIXED_TIME_STEP;
+    return SafeMin(1.0f, alpha);
+}
+
+/**
+ * Constructor for SnapshotBuffer class
+ * Slot 0 starts with the writer, slot 1 is shared, slot 2 is read until
+ * the first snapshot is published
+ */
+SnapshotBuffer::SnapshotBuffer() :
+    shared(1),
+    writeSlot(0),
+    readSlot(2),
+    published(0) {
+}
+
+/**
+ * Gets the writer's slot to fill with the next snapshot
+ * Writer thread only
+ * @return Slot holding an older snapshot, to be overwritten completely
+ */
+RenderSnapshot& SnapshotBuffer::BeginWrite() {
+    return slots[writeSlot];
+}
+
+/**
+ * Hands the filled writer slot to the reader and takes over the shared slot
+ * An unread snapshot in the shared slot is replaced by the newer one
+ * Writer thread only
+ */
+void SnapshotBuffer::Publish() {
+    slots[writeSlot].sequence = published++;
+    writeSlot = shared.exchange(writeSlot | FRESH_FLAG, std::memory_order_acq_rel) & ~FRESH_FLAG;
+}
+
+/**
+ * Gets the newest published snapshot
+ * Takes over the shared slot if it holds a snapshot not read yet, otherwise
+ * returns the snapshot of the previous call again
+ * Reader thread only; the reference stays valid until the next Acquire()
+ * @return Newest complete snapshot
+ */
+const RenderSnapshot& SnapshotBuffer::Acquire() {
+    if (shared.load(std::memory_order_relaxed) & FRESH_FLAG) {
+        readSlot = shared.exchange(readSlot, std::memory_order_acq_rel) & ~FRESH_FLAG;
+    }
+    return slots[readSlot];
+}
@@ -0,0 +1,69 @@
+#ifndef RENDERSNAPSHOT_H
+#define RENDERSNAPSHOT_H
+
+#include "gamestate.h"
+#include "score.h"
+#include "spaceship.h"
+#include "objectmanager.h"
+#include "highscoreManager.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Copy of everything the renderer draws, taken after a simulation step
+ * Owned by a SnapshotBuffer slot; copying into a reused slot keeps the
+ * vectors' capacity, so publishing does not allocate once warmed up
+ */
+struct RenderSnapshot {
+    GameStateManager stateManager;          // Current state, menu selection and name entry
+    Score score;                            // Score, level and high score
+    Spaceship player;                       // Player ship including its previous step for interpolation
+    int currentItem = 0;                    // Held power-up item
+    AsteroidStore asteroids;                // All asteroids, with previous positions
+    ProjectileStore projectiles;            // All projectiles, with previous positions
+    std::vector<PowerUp> powerups;          // All power-ups
+    PoolStats projectileStats = {};         // Projectile pool usage for the profiler overlay
+    PoolStats asteroidStats = {};           // Asteroid pool usage for the profiler overlay
+    PoolStats powerupStats = {};            // Power-up pool usage for the profiler overlay
+    std::vector<HighscoreEntry> highscores; // High score table
+    unsigned int shotsFired = 0;            // Shots fired so far; Draw() plays a sound for new ones
+    unsigned int highscoreRevision = 0;     // Bumped per added high score; Draw() saves the table when it changes
+    float stepRemainder = 0.0f;             // Accumulated time not yet simulated when published, in seconds
+    uint64_t tickAllocations = 0;           // Heap allocations of the last simulation step
+    std::chrono::steady_clock::time_point publishTime; // When the snapshot was published
+    unsigned int sequence = 0;              // Number of snapshots published before this one
+
+    float GetInterpolationAlpha(std::chrono::steady_clock::time_point now /* Render time */) const;
+};
+
+/**
+ * SnapshotBuffer class passing render snapshots from the simulation thread
+ * to the render thread without locks (triple buffering)
+ * The writer fills its private slot and swaps it with the shared slot; the
+ * reader swaps its private slot with the shared one whenever a newer
+ * snapshot is waiting. Neither side ever waits for the other, and the reader
+ * always holds a complete snapshot
+ * Exactly one writer thread and one reader thread may use a buffer
+ */
+class SnapshotBuffer {
+private:
+    RenderSnapshot slots[3];        // Writer, shared and reader slot (roles rotate)
+    std::atomic<int> shared;        // Index of the shared slot, FRESH_FLAG set while unread
+    int writeSlot;                  // Slot owned by the writer
+    int readSlot;                   // Slot owned by the reader
+    unsigned int published;         // Snapshots published so far (writer side)
+    static const int FRESH_FLAG = 4; // Marks a shared slot the reader has not taken yet
+
+public:
+    SnapshotBuffer();
+    SnapshotBuffer(const SnapshotBuffer&) = delete;
+    SnapshotBuffer& operator=(const SnapshotBuffer&) = delete;
+
+    RenderSnapshot& BeginWrite();
+    void Publish();
+    const RenderSnapshot& Acquire();
+};
+
+#endif
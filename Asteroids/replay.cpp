@@ -0,0 +1,310 @@
+#include "replay.h"
+#include "raylib.h"
+#include "globals.h"
+#include "random.h"
+#include <fstream>
+#include <iterator>
+
+// Keys the game reads while playing; order defines the bit layout (REPLAY_VERSION)
+static const int RECORDED_KEYS[] = {
+    KEY_UP, KEY_DOWN, KEY_LEFT, KEY_RIGHT,
+    KEY_W, KEY_A, KEY_S, KEY_D,
+    KEY_SPACE, KEY_LEFT_SHIFT, KEY_TAB, KEY_ENTER,
+    KEY_ESCAPE, KEY_BACKSPACE, KEY_MINUS
+};
+static const int RECORDED_KEY_COUNT = sizeof(RECORDED_KEYS) / sizeof(RECORDED_KEYS[0]);
+static const int PRESSED_SHIFT = 16;   // Pressed bits follow the held bits
+
+/**
+ * Appends a 32-bit value in little-endian byte order
+ */
+static void WriteU32(std::vector<unsigned char>& out, uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+        out.push_back((unsigned char)(value >> (i * 8)));
+    }
+}
+
+/**
+ * Appends an unsigned LEB128 varint (7 bits per byte)
+ */
+static void WriteVarint(std::vector<unsigned char>& out, uint32_t value) {
+    while (value >= 0x80) {
+        out.push_back((unsigned char)(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back((unsigned char)value);
+}
+
+/**
+ * Reads a little-endian 32-bit value
+ * @return False if the data ends early
+ */
+static bool ReadU32(const std::vector<unsigned char>& in, size_t& pos, uint32_t& value) {
+    if (pos + 4 > in.size()) return false;
+    value = 0;
+    for (int i = 0; i < 4; i++) {
+        value |= (uint32_t)in[pos++] << (i * 8);
+    }
+    return true;
+}
+
+/**
+ * Reads an unsigned LEB128 varint
+ * @return False if the data ends early or the varint is too long
+ */
+static bool ReadVarint(const std::vector<unsigned char>& in, size_t& pos, uint32_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 35; shift += 7) {
+        if (pos >= in.size()) return false;
+        unsigned char byte = in[pos++];
+        value |= (uint32_t)(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) return true;
+    }
+    return false;
+}
+
+namespace ReplayKeys {
+
+    /**
+     * Finds the slot of a key in the replay key table
+     * @param key Raylib key code
+     * @return Slot index, or -1 if the key is not recorded
+     */
+    int GetSlot(int key) {
+        for (int slot = 0; slot < RECORDED_KEY_COUNT; slot++) {
+            if (RECORDED_KEYS[slot] == key) return slot;
+        }
+        return -1;
+    }
+
+    /**
+     * Captures the state of all recorded keys for the current tick
+     * @param source Source to read the keys from
+     * @return Tick mask with held bits in the low and pressed bits in the high half
+     */
+    uint32_t Sample(const InputSource& source) {
+        uint32_t mask = 0;
+        for (int slot = 0; slot < RECORDED_KEY_COUNT; slot++) {
+            if (source.IsKeyDown(RECORDED_KEYS[slot])) mask |= 1u << slot;
+            if (source.IsKeyPressed(RECORDED_KEYS[slot])) mask |= 1u << (slot + PRESSED_SHIFT);
+        }
+        return mask;
+    }
+
+    /**
+     * Checks the held bit of a key slot
+     */
+    bool IsDown(uint32_t mask, int slot) {
+        return (mask & (1u << slot)) != 0;
+    }
+
+    /**
+     * Checks the pressed bit of a key slot
+     */
+    bool IsPressed(uint32_t mask, int slot) {
+        return (mask & (1u << (slot + PRESSED_SHIFT))) != 0;
+    }
+
+    /**
+     * Scripted input of a benchmark or test pilot
+     * Holds a random mix of thrust, turning and fire for 15 ticks at a time;
+     * the same seed, pilot and tick always give the same mask
+     * @param seed Match or session seed
+     * @param pilot Player or session index
+     * @param tick Tick the input is for
+     * @return Tick mask with held bits only
+     */
+    uint32_t PilotMask(uint32_t seed, int pilot, int tick) {
+        static const int slotUp = GetSlot(KEY_UP);
+        static const int slotLeft = GetSlot(KEY_LEFT);
+        static const int slotRight = GetSlot(KEY_RIGHT);
+        static const int slotSpace = GetSlot(KEY_SPACE);
+
+        RandomGenerator random(((uint64_t)seed << 32) ^ ((uint64_t)pilot << 24) ^ (uint64_t)(tick / 15));
+        uint32_t bits = random.Next();
+        uint32_t mask = 0;
+        if (bits & 1) mask |= 1u << slotUp;
+        if (bits & 2) mask |= 1u << slotLeft;
+        else if (bits & 4) mask |= 1u << slotRight;
+        if (bits & 8) mask |= 1u << slotSpace;
+        return mask;
+    }
+}
+
+/**
+ * Constructor for ReplayRecorder class
+ * Records nothing until Begin() provides a live source
+ */
+ReplayRecorder::ReplayRecorder() :
+    source(nullptr),
+    currentMask(0) {
+}
+
+/**
+ * Starts a new recording from a live input source
+ * @param liveSource Source to record from
+ */
+void ReplayRecorder::Begin(InputSource* liveSource) {
+    source = liveSource;
+    masks.clear();
+    currentMask = 0;
+}
+
+/**
+ * Writes the recording to a replay file
+ * Consecutive identical masks are stored as one run
+ * @param path Output file
+ * @param seed Seed the session was started with
+ * @param finalScore Score at the end of the recording
+ * @param finalChecksum Game state checksum at the end of the recording
+ * @return False if the file cannot be written
+ */
+bool ReplayRecorder::Save(const char* path, uint32_t seed, int finalScore, uint32_t finalChecksum) const {
+    std::vector<unsigned char> data;
+    data.reserve(64 + masks.size() / 4);
+
+    WriteU32(data, REPLAY_MAGIC);
+    WriteU32(data, REPLAY_VERSION);
+    WriteU32(data, seed);
+    WriteU32(data, SIMULATION_RATE);
+    WriteU32(data, (uint32_t)masks.size());
+    WriteU32(data, (uint32_t)finalScore);
+    WriteU32(data, finalChecksum);
+
+    uint32_t previous = 0;
+    size_t i = 0;
+    while (i < masks.size()) {
+        size_t runEnd = i + 1;
+        while (runEnd < masks.size() && masks[runEnd] == masks[i]) runEnd++;
+
+        WriteVarint(data, (uint32_t)(runEnd - i));
+        WriteVarint(data, masks[i] ^ previous);
+        previous = masks[i];
+        i = runEnd;
+    }
+
+    std::ofstream file(path, std::ios::binary);
+    if (!file.is_open()) return false;
+    file.write((const char*)data.data(), (std::streamsize)data.size());
+    return file.good();
+}
+
+/**
+ * Forwards the frame start to the live source
+ */
+void ReplayRecorder::NextFrame() {
+    if (source) source->NextFrame();
+}
+
+/**
+ * Advances the live source and records its recorded keys for this tick
+ */
+void ReplayRecorder::NextTick() {
+    if (!source) return;
+    source->NextTick();
+    currentMask = ReplayKeys::Sample(*source);
+    masks.push_back(currentMask);
+}
+
+/**
+ * Checks whether a key is held on the current tick
+ * @param key Raylib key code
+ * @return Recorded state for table keys, live state for all others
+ */
+bool ReplayRecorder::IsKeyDown(int key) const {
+    int slot = ReplayKeys::GetSlot(key);
+    if (slot < 0) return source && source->IsKeyDown(key);
+    return ReplayKeys::IsDown(currentMask, slot);
+}
+
+/**
+ * Checks whether a key was pressed on the current tick
+ * @param key Raylib key code
+ * @return Recorded state for table keys, live state for all others
+ */
+bool ReplayRecorder::IsKeyPressed(int key) const {
+    int slot = ReplayKeys::GetSlot(key);
+    if (slot < 0) return source && source->IsKeyPressed(key);
+    return ReplayKeys::IsPressed(currentMask, slot);
+}
+
+/**
+ * Constructor for ReplayPlayer class
+ * Plays nothing until a file is loaded
+ */
+ReplayPlayer::ReplayPlayer() :
+    header(),
+    tick(-1) {
+}
+
+/**
+ * Loads and decodes a replay file and rewinds playback
+ * @param path Replay file to read
+ * @return False if the file is missing, truncated, of another version,
+ *         recorded at another simulation rate or claims more ticks than
+ *         REPLAY_MAX_SECONDS allows
+ */
+bool ReplayPlayer::Load(const char* path) {
+    masks.clear();
+    tick = -1;
+
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) return false;
+    std::vector<unsigned char> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    size_t pos = 0;
+    uint32_t score = 0;
+    if (!ReadU32(data, pos, header.magic) || header.magic != REPLAY_MAGIC) return false;
+    if (!ReadU32(data, pos, header.version) || header.version != REPLAY_VERSION) return false;
+    if (!ReadU32(data, pos, header.seed) ||
+        !ReadU32(data, pos, header.simulationRate) || header.simulationRate != SIMULATION_RATE ||
+        !ReadU32(data, pos, header.tickCount) ||
+        !ReadU32(data, pos, score) ||
+        !ReadU32(data, pos, header.finalChecksum)) return false;
+    header.finalScore = (int32_t)score;
+
+    // The tick count sizes the mask buffer, so a corrupt header must not
+    // be able to request gigabytes
+    if (header.tickCount > (uint32_t)REPLAY_MAX_SECONDS * SIMULATION_RATE) return false;
+
+    masks.reserve(header.tickCount);
+    uint32_t mask = 0;
+    while (masks.size() < header.tickCount) {
+        uint32_t runLength, delta;
+        if (!ReadVarint(data, pos, runLength) || !ReadVarint(data, pos, delta)) return false;
+        if (runLength == 0 || masks.size() + runLength > header.tickCount) return false;
+
+        mask ^= delta;
+        masks.insert(masks.end(), runLength, mask);
+    }
+    return true;
+}
+
+/**
+ * Advances playback by one tick
+ */
+void ReplayPlayer::NextTick() {
+    if (tick < (int)masks.size()) tick++;
+}
+
+/**
+ * Checks whether a key is held on the current tick
+ * @param key Raylib key code
+ * @return Recorded state, false for keys outside the replay key table
+ */
+bool ReplayPlayer::IsKeyDown(int key) const {
+    int slot = ReplayKeys::GetSlot(key);
+    if (slot < 0 || tick < 0 || tick >= (int)masks.size()) return false;
+    return ReplayKeys::IsDown(masks[tick], slot);
+}
+
+/**
+ * Checks whether a key was pressed on the current tick
+ * @param key Raylib key code
+ * @return Recorded state, false for keys outside the replay key table
+ */
+bool ReplayPlayer::IsKeyPressed(int key) const {
+    int slot = ReplayKeys::GetSlot(key);
+    if (slot < 0 || tick < 0 || tick >= (int)masks.size()) return false;
+    return ReplayKeys::IsPressed(masks[tick], slot);
+}
@@ -0,0 +1,95 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include "inputSource.h"
+#include <cstdint>
+#include <vector>
+
+#define REPLAY_MAGIC 0x4C505241u    // "ARPL" in little-endian byte order
+#define REPLAY_VERSION 1            // Bumped whenever the file layout or key table changes
+#define REPLAY_MAX_SECONDS (24 * 60 * 60)   // Longest session a replay file may claim to hold
+
+/**
+ * Fixed-size header at the start of every replay file
+ * The expected results let playback verify that the session was reproduced
+ */
+struct ReplayHeader {
+    uint32_t magic;             // REPLAY_MAGIC
+    uint32_t version;           // REPLAY_VERSION
+    uint32_t seed;              // Random seed the session was started with
+    uint32_t simulationRate;    // Fixed steps per second of the recording
+    uint32_t tickCount;         // Number of recorded ticks
+    int32_t finalScore;         // Score when the recording ended
+    uint32_t finalChecksum;     // Game state checksum when the recording ended
+};
+
+/**
+ * Replay key table shared by recorder and player
+ * Each key occupies one "held" bit and one "pressed" bit of a tick mask
+ */
+namespace ReplayKeys {
+    int GetSlot(int key /* Raylib key code */);
+    uint32_t Sample(const InputSource& source /* Source to read the recorded keys from */);
+    bool IsDown(uint32_t mask /* Tick mask */, int slot /* Key slot */);
+    bool IsPressed(uint32_t mask /* Tick mask */, int slot /* Key slot */);
+    uint32_t PilotMask(uint32_t seed /* Match or session seed */,
+        int pilot /* Player or session index */,
+        int tick /* Tick the input is for */);
+}
+
+/**
+ * ReplayRecorder wrapping another input source and recording every tick
+ * Recorded keys are answered from the sampled mask, so the simulation sees
+ * exactly what a later playback will see; other keys (e.g. name entry
+ * letters) pass through to the wrapped source unrecorded
+ *
+ * File layout after the header: runs of identical tick masks, each stored
+ * as varint run length followed by varint (mask XOR previous run's mask)
+ */
+class ReplayRecorder : public InputSource {
+private:
+    InputSource* source;            // Wrapped source providing the live input
+    std::vector<uint32_t> masks;    // One key mask per recorded tick
+    uint32_t currentMask;           // Mask of the current tick
+
+public:
+    ReplayRecorder();
+
+    void Begin(InputSource* liveSource /* Source to record from */);
+    bool Save(const char* path /* Output file */,
+        uint32_t seed /* Seed the session was started with */,
+        int finalScore /* Score at the end of the recording */,
+        uint32_t finalChecksum /* Game state checksum at the end of the recording */) const;
+    int GetTickCount() const { return (int)masks.size(); }
+    InputSource* GetSource() const { return source; }
+
+    void NextFrame() override;
+    void NextTick() override;
+    bool IsKeyDown(int key) const override;
+    bool IsKeyPressed(int key) const override;
+};
+
+/**
+ * ReplayPlayer feeding a recorded replay file back to the input handler
+ * Reports no keys once all recorded ticks have been played
+ */
+class ReplayPlayer : public InputSource {
+private:
+    ReplayHeader header;            // Header of the loaded file
+    std::vector<uint32_t> masks;    // Decoded key mask per tick
+    int tick;                       // Tick currently being played (-1 before the first tick)
+
+public:
+    ReplayPlayer();
+
+    bool Load(const char* path /* Replay file to read */);
+    const ReplayHeader& GetHeader() const { return header; }
+    int GetTick() const { return tick; }
+    bool IsFinished() const { return tick + 1 >= (int)masks.size(); }  // All recorded ticks played
+
+    void NextTick() override;
+    bool IsKeyDown(int key) const override;
+    bool IsKeyPressed(int key) const override;
+};
+
+#endif
@@ -0,0 +1,208 @@
+#include "rollbackSession.h"
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+
+/**
+ * Constructor for RollbackSession class
+ * Every player constructed with the same seed starts from the same world
+ * @param players Ships in the session (clamped to 1 - MAX_SESSION_PLAYERS)
+ * @param localIndex Ship controlled by this session
+ * @param inputTransport Connection to the other players
+ * @param seed Match seed, the same for every player
+ */
+RollbackSession::RollbackSession(int players, int localIndex, InputTransport& inputTransport, uint32_t seed) :
+    playerCount(std::max(1, std::min(players, MAX_SESSION_PLAYERS))),
+    localPlayer(localIndex),
+    transport(inputTransport),
+    world(players, seed),
+    currentTick(0),
+    rollbackTick(-1) {
+    for (int player = 0; player < MAX_SESSION_PLAYERS; player++) {
+        receivedUpTo[player] = 0;
+        for (int slot = 0; slot < INPUT_RING_SIZE; slot++) {
+            inputs[player][slot] = 0;
+            inputTicks[player][slot] = -1;
+        }
+    }
+}
+
+/**
+ * Checks whether a player's input for a tick is known
+ */
+bool RollbackSession::HasInput(int player, int tick) const {
+    return tick >= 0 && inputTicks[player][tick % INPUT_RING_SIZE] == tick;
+}
+
+/**
+ * Gets a player's input for a tick, predicting it if it has not arrived
+ * The prediction repeats the newest input known without gaps
+ * @param player Ship index
+ * @param tick Tick to get the input for
+ * @return Received or predicted replay key mask
+ */
+uint32_t RollbackSession::GetInput(int player, int tick) const {
+    if (HasInput(player, tick)) return inputs[player][tick % INPUT_RING_SIZE];
+
+    int lastKnown = receivedUpTo[player] - 1;
+    return HasInput(player, lastKnown) ? inputs[player][lastKnown % INPUT_RING_SIZE] : 0;
+}
+
+/**
+ * Records a player's input for a tick
+ * Ticks already known, or too far from the confirmed tick to fit the ring, are ignored
+ * Marks a rollback if the input differs from the one a simulated tick predicted
+ * @param player Ship index
+ * @param tick Tick the input belongs to
+ * @param mask Replay key mask
+ */
+void RollbackSession::StoreInput(int player, int tick, uint32_t mask) {
+    if (tick < receivedUpTo[player] || tick >= receivedUpTo[player] + INPUT_RING_SIZE) return;
+    if (HasInput(player, tick)) return;
+
+    inputs[player][tick % INPUT_RING_SIZE] = mask;
+    inputTicks[player][tick % INPUT_RING_SIZE] = tick;
+    while (HasInput(player, receivedUpTo[player])) {
+        receivedUpTo[player]++;
+    }
+
+    if (player == localPlayer) return;
+
+    int predictedFor = currentTick - tick;
+    stats.remoteInputs++;
+    stats.latencyTicks += std::max(0, predictedFor);
+    stats.worstLatencyTicks = std::max(stats.worstLatencyTicks, predictedFor);
+    if (tick < currentTick) {
+        stats.lateInputs++;
+        if (frames[tick % (ROLLBACK_WINDOW + 1)].inputs[player] != mask
+            && (rollbackTick < 0 || tick < rollbackTick)) {
+            rollbackTick = tick;
+        }
+    }
+}
+
+/**
+ * Drains the transport and records every remote input it carried
+ */
+void RollbackSession::ReceiveInputs() {
+    InputPacket packet;
+    while (transport.Receive(packet)) {
+        int player = (int)packet.player;
+        if (player < 0 || player >= playerCount || player == localPlayer) continue;
+
+        // Oldest first, so receivedUpTo advances through the repeated ticks in order
+        for (int i = INPUT_PACKET_HISTORY - 1; i >= 0; i--) {
+            int tick = (int)packet.tick - i;
+            if (tick >= 0) StoreInput(player, tick, packet.masks[i]);
+        }
+    }
+}
+
+/**
+ * Sends the newest local inputs to the other players
+ * Every packet repeats the previous INPUT_PACKET_HISTORY - 1 ticks
+ */
+void RollbackSession::SendLocalInput() {
+    int newest = receivedUpTo[localPlayer] - 1;
+    if (newest < 0) return;
+
+    InputPacket packet;
+    packet.player = (uint32_t)localPlayer;
+    packet.tick = (uint32_t)newest;
+    for (int i = 0; i < INPUT_PACKET_HISTORY; i++) {
+        packet.masks[i] = newest - i >= 0 ? GetInput(localPlayer, newest - i) : 0;
+    }
+    transport.Send(packet);
+}
+
+/**
+ * Polls the transport and corrects mispredicted ticks without advancing
+ * Lets a stalled or idle session catch up with late input
+ */
+void RollbackSession::Synchronize() {
+    ReceiveInputs();
+    if (rollbackTick < 0) return;
+
+    Resimulate();
+}
+
+/**
+ * Simulates the next tick with the local input and the received or predicted remote inputs
+ * Refuses to advance while a remote player is ROLLBACK_WINDOW ticks behind,
+ * since a correction older than the stored frames could not be applied
+ * @param localMask Replay key mask of the local player for the next tick
+ * @return False if the session stalled waiting for remote input
+ */
+bool RollbackSession::AdvanceTick(uint32_t localMask) {
+    ReceiveInputs();
+
+    for (int player = 0; player < playerCount; player++) {
+        if (currentTick - receivedUpTo[player] >= ROLLBACK_WINDOW) {
+            stats.stalls++;
+            SendLocalInput(); // Repeat in case the peer is waiting on a lost packet
+            if (rollbackTick >= 0) Synchronize();
+            return false;
+        }
+    }
+
+    StoreInput(localPlayer, currentTick, localMask);
+    SendLocalInput();
+
+    if (rollbackTick >= 0) Resimulate();
+    SimulateTick(currentTick);
+
+    currentTick++;
+    stats.ticks++;
+    return true;
+}
+
+/**
+ * Restores the world at the earliest mispredicted tick and simulates forward
+ * to the current tick with the corrected inputs
+ */
+void RollbackSession::Resimulate() {
+    auto start = std::chrono::steady_clock::now();
+
+    int firstTick = rollbackTick;
+    rollbackTick = -1;
+    if (!world.Load(frames[firstTick % (ROLLBACK_WINDOW + 1)].world)) {
+        // Every tick inside the window was saved before it was simulated
+        assert(!"Rollback frame holds no saved world");
+        return;
+    }
+    for (int tick = firstTick; tick < currentTick; tick++) {
+        SimulateTick(tick);
+    }
+
+    double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    stats.rollbacks++;
+    stats.resimulatedTicks += currentTick - firstTick;
+    stats.resimulateMs += elapsedMs;
+    stats.worstRollbackMs = std::max(stats.worstRollbackMs, elapsedMs);
+}
+
+/**
+ * Saves the tick's start state with the inputs it uses, then simulates it
+ * @param tick Tick to simulate
+ */
+void RollbackSession::SimulateTick(int tick) {
+    TickFrame& frame = frames[tick % (ROLLBACK_WINDOW + 1)];
+    for (int player = 0; player < MAX_SESSION_PLAYERS; player++) {
+        frame.inputs[player] = player < playerCount ? GetInput(player, tick) : 0;
+    }
+    world.Save(frame.world);
+    world.Step(frame.inputs);
+}
+
+/**
+ * Gets the newest tick for which every player's input is known
+ * The world up to this tick can no longer change through a rollback
+ * @return Number of ticks with confirmed input
+ */
+int RollbackSession::GetConfirmedTick() const {
+    int confirmed = currentTick;
+    for (int player = 0; player < playerCount; player++) {
+        confirmed = std::min(confirmed, receivedUpTo[player]);
+    }
+    return confirmed;
+}
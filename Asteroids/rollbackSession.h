@@ -0,0 +1,83 @@
+#ifndef ROLLBACKSESSION_H
+#define ROLLBACKSESSION_H
+
+#include "netTransport.h"
+#include "sessionWorld.h"
+#include <cstdint>
+
+#define ROLLBACK_WINDOW 16          // Ticks a remote input may lag behind before the session stalls
+#define INPUT_RING_SIZE (2 * ROLLBACK_WINDOW + INPUT_PACKET_HISTORY)  // Remembered ticks of input per player
+
+/**
+ * Counters of a rollback session, for tuning and benchmarks
+ */
+struct RollbackStats {
+    int ticks = 0;                  // Ticks simulated for the first time
+    int rollbacks = 0;              // Corrections that rewound the world
+    int resimulatedTicks = 0;       // Ticks simulated again after a rollback
+    double resimulateMs = 0.0;      // Total time spent re-simulating
+    double worstRollbackMs = 0.0;   // Longest single rewind plus re-simulation
+    int stalls = 0;                 // Advance calls refused because a remote input was too late
+    int lateInputs = 0;             // Remote inputs that arrived after their tick was simulated
+    int latencyTicks = 0;           // Sum over all remote inputs of ticks until they were shown
+    int worstLatencyTicks = 0;      // Most ticks a remote input needed to be shown
+    int remoteInputs = 0;           // Remote inputs received
+};
+
+/**
+ * RollbackSession class running one player's copy of a multiplayer match
+ * Every player runs an identical simulation of all ships. Local input is
+ * applied immediately and sent to the others; remote input that has not
+ * arrived yet is predicted by repeating the player's last known input.
+ * The world is snapshotted at the start of every tick, and when a remote
+ * input turns out different from its prediction the world is restored to
+ * that tick and re-simulated up to the present
+ */
+class RollbackSession {
+private:
+    /**
+     * World at the start of a tick and the input it was simulated with
+     */
+    struct TickFrame {
+        SessionFrame world;                             // World at the start of the tick
+        uint32_t inputs[MAX_SESSION_PLAYERS];           // Input used for the tick (received or predicted)
+    };
+
+    int playerCount;                                    // Ships in the session
+    int localPlayer;                                    // Ship controlled by this session's input
+    InputTransport& transport;                          // Carries input to and from the other players
+    SessionWorld world;                                 // This player's copy of the match
+    TickFrame frames[ROLLBACK_WINDOW + 1];              // Ring of tick start states
+    uint32_t inputs[MAX_SESSION_PLAYERS][INPUT_RING_SIZE];  // Known input per player and tick
+    int inputTicks[MAX_SESSION_PLAYERS][INPUT_RING_SIZE];   // Tick each input slot holds (-1 = empty)
+    int receivedUpTo[MAX_SESSION_PLAYERS];              // Every input before this tick is known
+    int currentTick;                                    // Next tick to simulate
+    int rollbackTick;                                   // Earliest mispredicted tick (-1 = none)
+    RollbackStats stats;                                // Counters since construction
+
+    bool HasInput(int player, int tick) const;
+    uint32_t GetInput(int player, int tick) const;
+    void StoreInput(int player, int tick, uint32_t mask);
+    void ReceiveInputs();
+    void SendLocalInput();
+    void Resimulate();
+    void SimulateTick(int tick);
+
+public:
+    RollbackSession(int players /* Ships in the session (1 - MAX_SESSION_PLAYERS) */,
+        int localIndex /* Ship controlled by this session */,
+        InputTransport& inputTransport /* Connection to the other players */,
+        uint32_t seed /* Match seed, the same for every player */);
+
+    bool AdvanceTick(uint32_t localMask /* Replay key mask of the local player for the next tick */);
+    void Synchronize();
+
+    int GetTick() const { return currentTick; }
+    int GetConfirmedTick() const;
+    int GetPlayerCount() const { return playerCount; }
+    const SessionWorld& GetWorld() const { return world; }
+    const RollbackStats& GetStats() const { return stats; }
+    uint32_t ComputeChecksum() const { return world.ComputeChecksum(); }
+};
+
+#endif
@@ -1,55 +1,58 @@
 // score.cpp
 #include "score.h"
-#include "globals.h"
 #include <fstream>
 #include <algorithm>
 
-// Definition of the global score variable
-int g_currentScore = 0;
-
 /**
  * Constructor for Score class
  * Initializes score values to default starting state
- * Loads existing high score from file and synchronizes global score variable
+ * Loads existing high score from file
  */
 Score::Score() {
     currentScore = 0;
     highScore = 0;
     level = 1;
     LoadHighScore();
-    g_currentScore = 0;
 }
 
 /**
  * Adds points to the current score and updates related systems
  * Updates high score if current score exceeds it
- * Recalculates level based on new score and synchronizes global variable
+ * Recalculates level based on new score
  * @param points Number of points to add to the current score
  */
 void Score::AddPoints(int points) {
     currentScore += points;
     highScore = std::max(highScore, currentScore);
     UpdateLevel();
-
-    // Update global variable for progressive difficulty
-    g_currentScore = currentScore;
 }
 
 /**
  * Resets the score system to initial game state
- * Clears current score, resets level to 1, and synchronizes global variable
+ * Clears current score and resets level to 1
  * Used when starting a new game session
  */
 void Score::Reset() {
     currentScore = 0;
     level = 1;
-    g_currentScore = 0; // Reset global variable
+}
+
+/**
+ * Replaces all score values with saved ones, e.g. from a world snapshot
+ * @param score Current score
+ * @param high High score
+ * @param currentLevel Level
+ */
+void Score::Restore(int score, int high, int currentLevel) {
+    currentScore = score;
+    highScore = high;
+    level = currentLevel;
 }
 
 /**
  * Updates the current level based on score progression
  * Level calculation remains for UI display but no longer affects difficulty
- * Progressive difficulty is now handled through the global score variable
+ * Progressive difficulty is handled by the session's SimulationContext
  */
 void Score::UpdateLevel() {
     // Level remains for UI display, but is no longer used for difficulty
@@ -24,6 +24,9 @@ public:
         return level;
     }
 
+    void Restore(int score /* Current score */,
+        int high /* High score */,
+        int currentLevel /* Level */);
     void UpdateLevel();
     void SaveHighScore();
     void LoadHighScore();
@@ -0,0 +1,129 @@
+#include "gameServer.h"
+#include "globals.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <iostream>
+
+/**
+ * Options of the server runner, parsed from the command line
+ */
+struct ServerOptions {
+    ServerConfig config;            // Settings of a single run
+    bool sweep = false;             // Run 64 - 1024 sessions instead of one count
+    bool verify = false;            // Replay sessions after the run and compare checksums
+    bool noClient = false;          // Run without the client stand-in
+};
+
+/**
+ * Prints the command line usage of the server runner
+ */
+static void PrintUsage() {
+    printf("Usage: AsteroidsServer [options]\n");
+    printf("  --sessions N   Concurrent sessions (default 256)\n");
+    printf("  --threads N    Simulation threads (default: hardware threads)\n");
+    printf("  --seconds S    Length of each run (default 10)\n");
+    printf("  --seed N       Seed of session 0 (default 12345)\n");
+    printf("  --sweep        Run 64, 128, 256, 512 and 1024 sessions\n");
+    printf("  --verify       Replay every session serially and compare checksums\n");
+    printf("  --no-client    Run without the local client stand-in\n");
+}
+
+/**
+ * Parses the command line into server options
+ * @param argc Argument count
+ * @param argv Argument values
+ * @param options Receives the parsed options
+ * @return False if an argument is unknown or lacks its value
+ */
+static bool ParseOptions(int argc, char** argv, ServerOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        bool hasValue = i + 1 < argc;
+
+        if (strcmp(arg, "--sessions") == 0 && hasValue) options.config.sessions = atoi(argv[++i]);
+        else if (strcmp(arg, "--threads") == 0 && hasValue) options.config.threads = atoi(argv[++i]);
+        else if (strcmp(arg, "--seconds") == 0 && hasValue) options.config.seconds = (float)atof(argv[++i]);
+        else if (strcmp(arg, "--seed") == 0 && hasValue) options.config.seed = (uint32_t)strtoul(argv[++i], nullptr, 10);
+        else if (strcmp(arg, "--sweep") == 0) options.sweep = true;
+        else if (strcmp(arg, "--verify") == 0) options.verify = true;
+        else if (strcmp(arg, "--no-client") == 0) options.noClient = true;
+        else return false;
+    }
+    return options.config.sessions > 0 && options.config.seconds > 0.0f;
+}
+
+/**
+ * Hosts the configured sessions for one run and prints the results
+ * @param options Server options
+ * @param sessions Number of sessions for this run
+ * @return False if a verified session differed from its replay
+ */
+static bool RunServer(const ServerOptions& options, int sessions) {
+    ServerConfig config = options.config;
+    config.sessions = sessions;
+    config.keepInputLogs = options.verify;
+
+    GameServer server(config);
+    LocalClient client(server, config.seed);
+    ServerStats stats = server.Run(options.noClient ? nullptr : &client);
+
+    double expectedTicks = stats.seconds * SIMULATION_RATE * stats.sessions;
+    double coresBusy = stats.busySeconds / stats.seconds;
+    printf("Server: %d sessions on %d threads, %.1f s\n", stats.sessions, stats.threads, stats.seconds);
+    printf("  Ticks          %10lld (%.1f%% of schedule)\n", stats.ticks,
+        expectedTicks > 0 ? stats.ticks * 100.0 / expectedTicks : 0.0);
+    printf("  Tick cost      %10.4f ms\n", stats.tickCostMs);
+    printf("  Cores busy     %10.2f\n", coresBusy);
+    printf("  Sessions/core  %10.0f at %d Hz\n", stats.sessionsPerCore, SIMULATION_RATE);
+    printf("  Tick latency   p50 %.3f ms, p99 %.3f ms, max %.3f ms\n",
+        stats.p50LatencyMs, stats.p99LatencyMs, stats.maxLatencyMs);
+    printf("  Games          %10d\n", stats.games);
+    if (!options.noClient) {
+        printf("  Client         %d reports, %d out of order, %d ticks without input\n",
+            client.GetReportCount(), client.GetOutOfOrderReports(), stats.lateInputs);
+    }
+
+    bool passed = true;
+    if (options.verify) {
+        int mismatches = 0;
+        for (int session = 0; session < server.GetSessionCount(); session++) {
+            if (!server.GetSession(session).Verify()) mismatches++;
+        }
+        printf("  Verification   %s (%d of %d sessions differ)\n",
+            mismatches == 0 ? "match" : "MISMATCH", mismatches, server.GetSessionCount());
+        passed = mismatches == 0;
+    }
+    return passed;
+}
+
+int main(int argc, char** argv) {
+    ServerOptions options;
+    if (!ParseOptions(argc, argv, options)) {
+        PrintUsage();
+        return 1;
+    }
+
+    try {
+        bool passed = true;
+        if (options.sweep) {
+            const int counts[] = { 64, 128, 256, 512, 1024 };
+            for (int sessions : counts) {
+                passed = RunServer(options, sessions) && passed;
+            }
+        }
+        else {
+            passed = RunServer(options, options.config.sessions);
+        }
+        return passed ? 0 : 1;
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Server error: " << e.what() << std::endl;
+        return -1;
+    }
+    catch (...) {
+        std::cerr << "Unknown error in server run!" << std::endl;
+        return -2;
+    }
+}
@@ -0,0 +1,269 @@
+#include "sessionWorld.h"
+#include "globals.h"
+#include "raylib.h"
+#include "replay.h"
+#include "worldChecksum.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+// Replay key slots read by the session (same bit layout as replay files)
+static const int SLOT_UP = ReplayKeys::GetSlot(KEY_UP);
+static const int SLOT_W = ReplayKeys::GetSlot(KEY_W);
+static const int SLOT_LEFT = ReplayKeys::GetSlot(KEY_LEFT);
+static const int SLOT_A = ReplayKeys::GetSlot(KEY_A);
+static const int SLOT_RIGHT = ReplayKeys::GetSlot(KEY_RIGHT);
+static const int SLOT_D = ReplayKeys::GetSlot(KEY_D);
+static const int SLOT_SPACE = ReplayKeys::GetSlot(KEY_SPACE);
+static const int SLOT_SHIFT = ReplayKeys::GetSlot(KEY_LEFT_SHIFT);
+
+static const float FIRE_COOLDOWN = 0.2f;    // Time between shots of one ship
+static const float RAPID_FIRE_COOLDOWN = 0.05f; // Time between shots while rapid fire is active
+static const int RAPID_FIRE_SHOTS = 50;     // Shots granted by a rapid fire item
+
+/**
+ * Constructor for SessionWorld class
+ * Seeds the world's random streams and spawns the first wave, so worlds
+ * constructed with the same seed start out identical
+ * @param players Ships in the session (clamped to 1 - MAX_SESSION_PLAYERS)
+ * @param seed Session seed
+ */
+SessionWorld::SessionWorld(int players, uint32_t seed) :
+    playerCount(std::max(1, std::min(players, MAX_SESSION_PLAYERS))),
+    asteroidSpawnTimer(0.0f),
+    context(seed),
+    objectManager(ships, playerCount, context),
+    collisionSystem(objectManager, context.GetScore()),
+    frameArena(SESSION_ARENA_SIZE) {
+    collisionSystem.SetFrameArena(&frameArena);
+    Reset(seed);
+}
+
+/**
+ * Starts the session over: new ships, first wave, reseeded streams
+ * The high score is kept
+ * @param seed Session seed
+ */
+void SessionWorld::Reset(uint32_t seed) {
+    context.Seed(seed);
+    context.GetScore().Reset();
+    for (int player = 0; player < MAX_SESSION_PLAYERS; player++) {
+        ships[player] = Spaceship();
+        fireCooldowns[player] = 0.0f;
+        heldItems[player] = 0;
+        rapidShots[player] = 0;
+    }
+    asteroidSpawnTimer = 0.0f;
+    objectManager.ResetObjects();
+    objectManager.SpawnAsteroids(4);
+    objectManager.ApplyPendingCommands();
+}
+
+/**
+ * Advances the world by one fixed step
+ * Mirrors Game::UpdateInGame for several ships: input, movement, objects,
+ * collisions, edge spawns, the sync point, wave respawns and power-up
+ * collection
+ * Ends by releasing the step's frame arena
+ * @param inputs Replay key mask of every ship for this tick
+ */
+void SessionWorld::Step(const uint32_t* inputs) {
+    for (int player = 0; player < playerCount; player++) {
+        ships[player].SavePreviousState();
+        if (ships[player].GetLives() > 0) {
+            ApplyShipInput(player, inputs[player]);
+        }
+    }
+    for (int player = 0; player < playerCount; player++) {
+        if (ships[player].GetLives() > 0) {
+            ships[player].Update(FIXED_TIME_STEP);
+        }
+        if (fireCooldowns[player] > 0) fireCooldowns[player] -= FIXED_TIME_STEP;
+    }
+
+    objectManager.UpdateObjects(FIXED_TIME_STEP);
+    asteroidSpawnTimer += FIXED_TIME_STEP;
+
+    collisionSystem.CheckCollisions(ships, playerCount);
+
+    if (asteroidSpawnTimer > context.GetEdgeSpawnInterval()) {
+        objectManager.SpawnAsteroid(objectManager.GetRandomEdgePosition(), LARGE);
+        asteroidSpawnTimer = 0;
+    }
+
+    // Sync point - no object vector is being iterated here
+    objectManager.ApplyPendingCommands();
+
+    if (objectManager.GetAsteroids().empty()) {
+        objectManager.SpawnAsteroids(context.GetWaveSize());
+    }
+
+    CollectPowerUps();
+
+    frameArena.Reset();
+}
+
+/**
+ * Applies thrust, rotation and shooting of one ship from its key mask
+ * @param player Ship index
+ * @param mask Replay key mask for this tick
+ */
+void SessionWorld::ApplyShipInput(int player, uint32_t mask) {
+    Spaceship& ship = ships[player];
+
+    if (ReplayKeys::IsDown(mask, SLOT_UP) || ReplayKeys::IsDown(mask, SLOT_W)) {
+        ship.StartThrust();
+        ship.ApplyThrust(FIXED_TIME_STEP);
+    }
+    else {
+        ship.StopThrust();
+    }
+
+    if (ReplayKeys::IsDown(mask, SLOT_LEFT) || ReplayKeys::IsDown(mask, SLOT_A)) {
+        ship.Rotate(-1, FIXED_TIME_STEP);
+    }
+    if (ReplayKeys::IsDown(mask, SLOT_RIGHT) || ReplayKeys::IsDown(mask, SLOT_D)) {
+        ship.Rotate(1, FIXED_TIME_STEP);
+    }
+
+    if (ReplayKeys::IsDown(mask, SLOT_SPACE) && fireCooldowns[player] <= 0) {
+        Vector2 shipPos = ship.GetPosition();
+        float radian = ship.GetRotation() * DEG2RAD;
+        Vector2 firePosition = {
+            shipPos.x + cosf(radian) * 20.0f,
+            shipPos.y + sinf(radian) * 20.0f
+        };
+        objectManager.FireProjectile(firePosition, ship.GetRotation());
+        fireCooldowns[player] = rapidShots[player] > 0 ? RAPID_FIRE_COOLDOWN : FIRE_COOLDOWN;
+        if (rapidShots[player] > 0) rapidShots[player]--;
+    }
+
+    if (ReplayKeys::IsPressed(mask, SLOT_SHIFT)) {
+        UseItem(player);
+    }
+}
+
+/**
+ * Activates the item a ship holds, like InputHandler::UseItem
+ * @param player Ship index
+ */
+void SessionWorld::UseItem(int player) {
+    switch (heldItems[player]) {
+    case 1: // Rapid Fire
+        rapidShots[player] = RAPID_FIRE_SHOTS;
+        break;
+
+    case 2: // Shield
+        ships[player].ActivateShield();
+        break;
+
+    case 3: // Extra Life
+        ships[player].AddLife();
+        break;
+
+    default:
+        break;
+    }
+    heldItems[player] = 0;
+}
+
+/**
+ * Lets every ship still in play collect one touching power-up, in ship
+ * order, like Game::CheckPowerUpCollisions
+ * Extra lives apply at once; rapid fire and shield become the held item
+ */
+void SessionWorld::CollectPowerUps() {
+    for (int player = 0; player < playerCount; player++) {
+        if (ships[player].GetLives() <= 0) continue;
+
+        PowerUpType type;
+        if (!objectManager.CollectPowerUp(player, type)) continue;
+
+        switch (type) {
+        case EXTRA_LIFE:
+            ships[player].AddLife();
+            heldItems[player] = 0;
+            break;
+
+        case RAPID_FIRE:
+            heldItems[player] = 1;
+            break;
+
+        case SHIELD:
+            heldItems[player] = 2;
+            break;
+
+        default:
+            break;
+        }
+    }
+}
+
+/**
+ * Saves the world into a frame
+ * @param frame Receives objects, score, timers, random streams and ships
+ */
+void SessionWorld::Save(SessionFrame& frame) const {
+    const Score& score = context.GetScore();
+    WorldState state = {};
+    state.player = ships[0];
+    state.score = score.GetScore();
+    state.highScore = score.GetHighScore();
+    state.level = score.GetLevel();
+    state.asteroidSpawnTimer = asteroidSpawnTimer;
+    state.objects = objectManager.GetState();
+    context.SaveRandom(state.random);
+
+    frame.world.Write(state, objectManager.GetAsteroids(), objectManager.GetProjectiles(),
+        objectManager.GetPowerUps(), objectManager.GetPendingCommands());
+    memcpy(frame.ships, ships, sizeof(ships));
+    memcpy(frame.fireCooldowns, fireCooldowns, sizeof(fireCooldowns));
+    memcpy(frame.heldItems, heldItems, sizeof(heldItems));
+    memcpy(frame.rapidShots, rapidShots, sizeof(rapidShots));
+}
+
+/**
+ * Replaces the world with one saved by Save()
+ * @param frame Saved world
+ * @return False (world untouched) if the frame holds no valid world
+ */
+bool SessionWorld::Load(const SessionFrame& frame) {
+    WorldState state;
+    if (!frame.world.Read(state, objectManager.GetAsteroidsMutable(), objectManager.GetProjectilesMutable(),
+        objectManager.GetPowerUpsMutable(), objectManager.GetPendingCommandsMutable())) {
+        return false;
+    }
+
+    context.GetScore().Restore(state.score, state.highScore, state.level);
+    asteroidSpawnTimer = state.asteroidSpawnTimer;
+    objectManager.SetState(state.objects);
+    context.RestoreRandom(state.random);
+    memcpy(ships, frame.ships, sizeof(ships));
+    memcpy(fireCooldowns, frame.fireCooldowns, sizeof(fireCooldowns));
+    memcpy(heldItems, frame.heldItems, sizeof(heldItems));
+    memcpy(rapidShots, frame.rapidShots, sizeof(rapidShots));
+    return true;
+}
+
+/**
+ * Checks whether every ship has run out of lives
+ * @return True if the session is over
+ */
+bool SessionWorld::IsOver() const {
+    for (int player = 0; player < playerCount; player++) {
+        if (ships[player].GetLives() > 0) return false;
+    }
+    return true;
+}
+
+/**
+ * Computes a checksum of the world
+ * Worlds fed the same seed and inputs have equal checksums
+ * @return FNV-1a hash of score, ships, held items and objects (see ComputeWorldChecksum)
+ */
+uint32_t SessionWorld::ComputeChecksum() const {
+    uint32_t hash = ComputeWorldChecksum(context.GetScore(), ships, playerCount, objectManager);
+    HashBytes(hash, heldItems, playerCount * sizeof(int));
+    HashBytes(hash, rapidShots, playerCount * sizeof(int));
+    return hash;
+}
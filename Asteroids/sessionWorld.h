@@ -0,0 +1,74 @@
+#ifndef SESSIONWORLD_H
+#define SESSIONWORLD_H
+
+#include "collisionSystem.h"
+#include "frameArena.h"
+#include "objectmanager.h"
+#include "score.h"
+#include "simulationContext.h"
+#include "spaceship.h"
+#include "worldSnapshot.h"
+#include <cstdint>
+
+#define MAX_SESSION_PLAYERS 4       // Ships per session
+#define SESSION_ARENA_SIZE (4 * 1024)   // Initial bytes of a session's frame arena
+
+/**
+ * Saved state of a SessionWorld
+ */
+struct SessionFrame {
+    WorldSnapshot world;                            // Objects, score, timers and random streams
+    Spaceship ships[MAX_SESSION_PLAYERS];           // All ships
+    float fireCooldowns[MAX_SESSION_PLAYERS];       // Time until each ship may fire again
+    int heldItems[MAX_SESSION_PLAYERS];             // Power-up item each ship holds
+    int rapidShots[MAX_SESSION_PLAYERS];            // Rapid fire shots each ship has left
+};
+
+/**
+ * SessionWorld class holding the simulation of one session without window,
+ * audio or menus: ships, objects, collisions and score
+ * Driven by one replay key mask per ship and tick, so multiplayer sessions
+ * and server sessions share the same rules
+ * Every ship is a full player: the object manager is bound to all of them,
+ * and each ship collects power-ups and holds its own item
+ *
+ * Random streams, score and difficulty live in the world's own
+ * SimulationContext, so different worlds can step on different threads
+ * at the same time
+ */
+class SessionWorld {
+private:
+    int playerCount;                                // Ships in the session
+    Spaceship ships[MAX_SESSION_PLAYERS];           // All ships
+    float fireCooldowns[MAX_SESSION_PLAYERS];       // Time until each ship may fire again
+    int heldItems[MAX_SESSION_PLAYERS];             // Power-up item each ship holds (same codes as Game)
+    int rapidShots[MAX_SESSION_PLAYERS];            // Rapid fire shots each ship has left
+    float asteroidSpawnTimer;                       // Time since the last edge spawn
+    SimulationContext context;                      // Random streams, shared score and difficulty
+    ObjectManager objectManager;                    // Asteroids, projectiles and power-ups
+    CollisionSystem collisionSystem;                // Projectile and ship collisions
+    FrameArena frameArena;                          // Per-step collision lists, reset after every Step()
+
+    void ApplyShipInput(int player, uint32_t mask);
+    void UseItem(int player);
+    void CollectPowerUps();
+
+public:
+    SessionWorld(int players /* Ships in the session (1 - MAX_SESSION_PLAYERS) */,
+        uint32_t seed /* Session seed */);
+
+    void Reset(uint32_t seed /* Session seed */);
+
+    void Step(const uint32_t* inputs /* Replay key mask per ship */);
+    void Save(SessionFrame& frame /* Receives the world */) const;
+    bool Load(const SessionFrame& frame /* World saved by Save() */);
+
+    int GetPlayerCount() const { return playerCount; }
+    const Spaceship& GetShip(int player /* Ship index */) const { return ships[player]; }
+    const Score& GetScore() const { return context.GetScore(); }
+    const ObjectManager& GetObjectManager() const { return objectManager; }
+    bool IsOver() const;
+    uint32_t ComputeChecksum() const;
+};
+
+#endif
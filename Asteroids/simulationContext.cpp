@@ -0,0 +1,75 @@
+#include "simulationContext.h"
+#include <algorithm>
+
+/**
+ * Constructor for SimulationContext class
+ * @param sessionSeed Seed of the random streams
+ */
+SimulationContext::SimulationContext(uint32_t sessionSeed) :
+    seed(0),
+    difficulty(),
+    score(),
+    stateManager() {
+    Seed(sessionSeed);
+}
+
+/**
+ * Reseeds every stream from one session seed
+ * Each channel gets its own, unrelated sequence
+ * @param sessionSeed Session seed
+ */
+void SimulationContext::Seed(uint32_t sessionSeed) {
+    seed = sessionSeed;
+    for (int channel = 0; channel < RANDOM_CHANNEL_COUNT; channel++) {
+        streams[channel].Seed(DeriveStreamSeed(seed, (uint32_t)channel));
+    }
+}
+
+/**
+ * Saves the session seed and the position of every simulation stream
+ * @param state Receives seed and stream states
+ */
+void SimulationContext::SaveRandom(RandomStreamState& state) const {
+    state.seed = seed;
+    for (int channel = 0; channel < RANDOM_EFFECTS; channel++) {
+        state.streams[channel] = streams[channel];
+    }
+}
+
+/**
+ * Rewinds the simulation streams to a saved position
+ * @param state State saved by SaveRandom()
+ */
+void SimulationContext::RestoreRandom(const RandomStreamState& state) {
+    seed = state.seed;
+    for (int channel = 0; channel < RANDOM_EFFECTS; channel++) {
+        streams[channel] = state.streams[channel];
+    }
+}
+
+/**
+ * Gets the speed factor of newly spawned asteroids
+ * 100% faster every speedupScore points, up to maxSpeedMultiplier
+ * @return Multiplier for asteroid speed and spin
+ */
+float SimulationContext::GetAsteroidSpeedMultiplier() const {
+    float multiplier = 1.0f + (score.GetScore() / difficulty.speedupScore);
+    return std::min(multiplier, difficulty.maxSpeedMultiplier);
+}
+
+/**
+ * Gets the time between asteroids entering from the screen edges
+ * @return Spawn interval in seconds
+ */
+float SimulationContext::GetEdgeSpawnInterval() const {
+    float reduction = score.GetScore() / difficulty.spawnIntervalScore;
+    return std::max(difficulty.minSpawnInterval, difficulty.baseSpawnInterval - reduction);
+}
+
+/**
+ * Gets the number of asteroids in the next wave
+ * @return Asteroids to spawn once the field is cleared
+ */
+int SimulationContext::GetWaveSize() const {
+    return std::min(difficulty.maxWaveSize, difficulty.baseWaveSize + score.GetScore() / difficulty.waveBonusScore);
+}
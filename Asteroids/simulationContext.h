@@ -0,0 +1,63 @@
+#ifndef SIMULATIONCONTEXT_H
+#define SIMULATIONCONTEXT_H
+
+#include "gamestate.h"
+#include "random.h"
+#include "score.h"
+#include <cstdint>
+
+/**
+ * Tuning of the progressive difficulty, all driven by the current score
+ */
+struct DifficultySettings {
+    float speedupScore = 5000.0f;       // Points that add another 100% asteroid speed
+    float maxSpeedMultiplier = 3.0f;    // Fastest asteroids relative to score 0
+    float baseSpawnInterval = 10.0f;    // Seconds between edge spawns at score 0
+    float minSpawnInterval = 3.0f;      // Shortest time between edge spawns
+    float spawnIntervalScore = 1000.0f; // Points that take one second off the spawn interval
+    int baseWaveSize = 4;               // Asteroids in a wave at score 0
+    int waveBonusScore = 2000;          // Points that add one asteroid to a wave
+    int maxWaveSize = 10;               // Largest wave
+};
+
+/**
+ * SimulationContext class holding the mutable state one session's
+ * simulation shares between its subsystems: random streams, score,
+ * difficulty and game state
+ * Every game, session world and benchmark owns its own context, so any
+ * number of sessions can simulate on different threads at once. Not
+ * synchronized - a context is used by one thread at a time
+ */
+class SimulationContext {
+private:
+    uint32_t seed;                                  // Session seed of the random streams
+    RandomGenerator streams[RANDOM_CHANNEL_COUNT];  // One stream per channel
+    DifficultySettings difficulty;                  // Progression tuning
+    Score score;                                    // Score of the session, drives the difficulty
+    GameStateManager stateManager;                  // Current game state and transitions
+
+public:
+    explicit SimulationContext(uint32_t sessionSeed = 0 /* Seed of the random streams */);
+
+    // Random streams
+    void Seed(uint32_t sessionSeed /* Session seed */);
+    uint32_t GetSeed() const { return seed; }
+    RandomGenerator& GetRandom(RandomChannel channel /* Stream to draw from */) { return streams[channel]; }
+    void SaveRandom(RandomStreamState& state /* Receives seed and stream states */) const;
+    void RestoreRandom(const RandomStreamState& state /* State saved by SaveRandom */);
+
+    // Score and game state
+    Score& GetScore() { return score; }
+    const Score& GetScore() const { return score; }
+    GameStateManager& GetStateManager() { return stateManager; }
+    const GameStateManager& GetStateManager() const { return stateManager; }
+
+    // Difficulty
+    const DifficultySettings& GetDifficulty() const { return difficulty; }
+    void SetDifficulty(const DifficultySettings& settings /* New tuning */) { difficulty = settings; }
+    float GetAsteroidSpeedMultiplier() const;
+    float GetEdgeSpawnInterval() const;
+    int GetWaveSize() const;
+};
+
+#endif
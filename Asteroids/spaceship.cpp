@@ -1,5 +1,6 @@
 #include "spaceship.h"
 #include "globals.h"
+#include "random.h"
 #include <cmath>
 
 // Mathematical constants
@@ -13,7 +14,9 @@ constexpr float DEG240 = 4.1887902f; // 240° in radians
  */
 Spaceship::Spaceship() :
     triangleSize(15.0f),
+    invulnerable(false),
     lives(STARTING_LIVES),
+    invulnerabilityTimer(0.0f),
     shieldActive(false),
     shieldTimer(0.0f),
     shieldAnimationTimer(0.0f)
@@ -37,6 +40,16 @@ void Spaceship::Reset() {
     shieldTimer = 0.0f;
     shieldAnimationTimer = 0.0f;
     UpdateTriangleGeometry();
+    SavePreviousState();
+}
+
+/**
+ * Stores position and rotation as the previous simulation state
+ * Called at the start of every simulation step, before input is applied
+ */
+void Spaceship::SavePreviousState() {
+    previousPosition = position;
+    previousRotation = rotation;
 }
 
 /**
@@ -90,26 +103,37 @@ void Spaceship::Update(float deltaTime) {
  * Called whenever position or rotation changes
  */
 void Spaceship::UpdateTriangleGeometry() {
-    const float rad = rotation * DEG2RAD;
+    ComputeTrianglePoints(position, rotation, trianglePoints);
+}
+
+/**
+ * Calculates the three vertices of a spaceship triangle
+ * Uses rotation matrix math for proper orientation
+ * @param center Center of the triangle
+ * @param angle Rotation angle in degrees
+ * @param points Output array receiving tip, left and right vertex
+ */
+void Spaceship::ComputeTrianglePoints(Vector2 center, float angle, Vector2 points[3]) const {
+    const float rad = angle * DEG2RAD;
     const float cosRot = cosf(rad);
     const float sinRot = sinf(rad);
 
     // Tip (forward point)
-    trianglePoints[0] = {
-        position.x + cosRot * triangleSize,
-        position.y + sinRot * triangleSize
+    points[0] = {
+        center.x + cosRot * triangleSize,
+        center.y + sinRot * triangleSize
     };
 
     // Left point
-    trianglePoints[1] = {
-        position.x + (cosRot * cosf(DEG120) - sinRot * sinf(DEG120)) * triangleSize,
-        position.y + (sinRot * cosf(DEG120) + cosRot * sinf(DEG120)) * triangleSize
+    points[1] = {
+        center.x + (cosRot * cosf(DEG120) - sinRot * sinf(DEG120)) * triangleSize,
+        center.y + (sinRot * cosf(DEG120) + cosRot * sinf(DEG120)) * triangleSize
     };
 
     // Right point
-    trianglePoints[2] = {
-        position.x + (cosRot * cosf(DEG240) - sinRot * sinf(DEG240)) * triangleSize,
-        position.y + (sinRot * cosf(DEG240) + cosRot * sinf(DEG240)) * triangleSize
+    points[2] = {
+        center.x + (cosRot * cosf(DEG240) - sinRot * sinf(DEG240)) * triangleSize,
+        center.y + (sinRot * cosf(DEG240) + cosRot * sinf(DEG240)) * triangleSize
     };
 }
 
@@ -118,35 +142,50 @@ void Spaceship::UpdateTriangleGeometry() {
  * Handles invulnerability blinking, shield visualization, and thrust effects
  * Draws shield first (behind spaceship), then spaceship with optional blinking
  * Creates particle effects for thrust when active
+ * Position and rotation are blended between the last two simulation steps
+ * @param effects Stream for cosmetic jitter, never a simulation stream
+ * @param alpha Interpolation factor, 0 = previous step, 1 = current step
  */
-void Spaceship::Draw() const {
+void Spaceship::Draw(RandomGenerator& effects, float alpha) const {
+    Vector2 drawPosition = position;
+    float drawRotation = rotation;
+    Vector2 drawPoints[3];
+
+    // Skip interpolation across a screen wrap
+    Vector2 delta = { position.x - previousPosition.x, position.y - previousPosition.y };
+    if (fabsf(delta.x) < SCREEN_WIDTH * 0.5f && fabsf(delta.y) < SCREEN_HEIGHT * 0.5f) {
+        drawPosition = { previousPosition.x + delta.x * alpha, previousPosition.y + delta.y * alpha };
+        drawRotation = previousRotation + (rotation - previousRotation) * alpha;
+    }
+    ComputeTrianglePoints(drawPosition, drawRotation, drawPoints);
+
     // Draw shield (in front of spaceship) - without flickering
     if (shieldActive) {
-        float shieldRadius = triangleSize + 8.0f;
+        float shieldRadius = GetShieldRadius();
 
         // Constant transparency - no pulsing
         Color shieldColor = BLUE;
         shieldColor.a = 100;
 
         // Outer shield ring
-        DrawCircleV(position, shieldRadius, shieldColor);
+        DrawCircleV(drawPosition, shieldRadius, shieldColor);
 
         // Inner ring for depth
         Color innerColor = BLUE;
         innerColor.a = 50;
-        DrawCircleV(position, shieldRadius - 2.0f, innerColor);
+        DrawCircleV(drawPosition, shieldRadius - 2.0f, innerColor);
 
         // Shield border
         Color borderColor = BLUE;
         borderColor.a = 180;
-        DrawCircleLines((int)position.x, (int)position.y, (int)shieldRadius, borderColor);
+        DrawCircleLines((int)drawPosition.x, (int)drawPosition.y, (int)shieldRadius, borderColor);
 
         // Additional energy effects (rotating particles)
         for (int i = 0; i < 6; i++) {
             float angle = (shieldAnimationTimer * 1.5f + (float)i * 60.0f) * DEG2RAD;
             Vector2 particlePos = {
-                position.x + cosf(angle) * (shieldRadius - 1.0f),
-                position.y + sinf(angle) * (shieldRadius - 1.0f)
+                drawPosition.x + cosf(angle) * (shieldRadius - 1.0f),
+                drawPosition.y + sinf(angle) * (shieldRadius - 1.0f)
             };
 
             Color particleColor = WHITE;
@@ -169,12 +208,12 @@ void Spaceship::Draw() const {
     for (int i = 0; i < 3; i++) {
         int next = (i + 1) % 3;
         Vector2 p1 = {
-            trianglePoints[i].x + (float)(GetRandomValue(0, 1)) - 0.5f,
-            trianglePoints[i].y + (float)(GetRandomValue(0, 1)) - 0.5f
+            drawPoints[i].x + (float)(effects.Range(0, 1)) - 0.5f,
+            drawPoints[i].y + (float)(effects.Range(0, 1)) - 0.5f
         };
         Vector2 p2 = {
-            trianglePoints[next].x + (float)(GetRandomValue(0, 1)) - 0.5f,
-            trianglePoints[next].y + (float)(GetRandomValue(0, 1)) - 0.5f
+            drawPoints[next].x + (float)(effects.Range(0, 1)) - 0.5f,
+            drawPoints[next].y + (float)(effects.Range(0, 1)) - 0.5f
         };
         DrawLineV(p1, p2, BLACK);
     }
@@ -183,14 +222,14 @@ void Spaceship::Draw() const {
     if (isThrusting) {
         // Center of the rear edge of the spaceship
         Vector2 thrustBase = {
-            (trianglePoints[1].x + trianglePoints[2].x) * 0.5f,
-            (trianglePoints[1].y + trianglePoints[2].y) * 0.5f
+            (drawPoints[1].x + drawPoints[2].x) * 0.5f,
+            (drawPoints[1].y + drawPoints[2].y) * 0.5f
         };
 
         // Direction vector (backward away from spaceship)
         Vector2 thrustDirection = {
-            position.x - trianglePoints[0].x,
-            position.y - trianglePoints[0].y
+            drawPosition.x - drawPoints[0].x,
+            drawPosition.y - drawPoints[0].y
         };
 
         // Normalize
@@ -201,15 +240,15 @@ void Spaceship::Draw() const {
         }
 
         // Generate particles
-        for (int i = 0; i < GetRandomValue(4, 6); i++) {
+        for (int i = 0; i < effects.Range(4, 6); i++) {
             Vector2 particlePos = {
-                thrustBase.x + (float)GetRandomValue(-5, 5) + thrustDirection.x * (float)GetRandomValue(10, 25),
-                thrustBase.y + (float)GetRandomValue(-5, 5) + thrustDirection.y * (float)GetRandomValue(10, 25)
+                thrustBase.x + (float)effects.Range(-5, 5) + thrustDirection.x * (float)effects.Range(10, 25),
+                thrustBase.y + (float)effects.Range(-5, 5) + thrustDirection.y * (float)effects.Range(10, 25)
             };
 
-            float size = (float)GetRandomValue(2, 6);
+            float size = (float)effects.Range(2, 6);
             Color particleColor;
-            int colorRand = GetRandomValue(0, 100);
+            int colorRand = effects.Range(0, 100);
             if (colorRand < 60) particleColor = ORANGE;
             else if (colorRand < 90) particleColor = RED;
             else particleColor = YELLOW;
@@ -3,6 +3,8 @@
 
 #include "raylib.h"
 
+class RandomGenerator;
+
 class Spaceship {
 private:
     // Core variables
@@ -10,6 +12,8 @@ private:
     Vector2 velocity;               // Movement speed and direction (pixels per second)
     float rotation;                 // Current rotation angle in degrees
     float triangleSize;             // Radius/size of the triangular spaceship
+    Vector2 previousPosition;       // Position before the last simulation step (render interpolation)
+    float previousRotation;         // Rotation before the last simulation step (render interpolation)
 
     // State variables
     bool isThrusting;               // Whether thrust is currently being applied
@@ -27,14 +31,19 @@ private:
     Vector2 trianglePoints[3];      // Triangle vertices (0=tip, 1=left, 2=right)
 
     void UpdateTriangleGeometry();
+    void ComputeTrianglePoints(Vector2 center /* Triangle center */,
+        float angle /* Rotation in degrees */,
+        Vector2 points[3] /* Output vertices (tip, left, right) */) const;
 
 public:
     Spaceship();
 
     // Core methods
     void Update(float deltaTime /* Time elapsed since last frame in seconds */);
-    void Draw() const;
+    void Draw(RandomGenerator& effects /* Stream for cosmetic jitter, never a simulation stream */,
+        float alpha = 1.0f /* Interpolation factor between the last two steps */) const;
     void Reset();
+    void SavePreviousState();
 
     // Control
     void StartThrust();
@@ -54,6 +63,12 @@ public:
     bool IsThrusting() const;
     int GetLives() const;
     Rectangle GetBounds() const;
+    const Vector2* GetTrianglePoints() const {
+        return trianglePoints;
+    }
+    float GetShieldRadius() const {
+        return triangleSize + 8.0f;
+    }
 
     // Shield methods
     void ActivateShield();
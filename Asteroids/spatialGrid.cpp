@@ -0,0 +1,234 @@
+#include "spatialGrid.h"
+#include "jobSystem.h"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+
+/**
+ * Constructor for SpatialGrid class
+ * Derives the column and row count from the world size and cell size
+ * Pre-allocates the cell offset table so Build() never reallocates it
+ * @param size Edge length of one grid cell in pixels
+ * @param worldWidth Width of the wrapping world in pixels
+ * @param worldHeight Height of the wrapping world in pixels
+ */
+SpatialGrid::SpatialGrid(float size, float worldWidth, float worldHeight) :
+    cellSize(size),
+    columns(std::max(1, static_cast<int>(std::ceil(worldWidth / size)))),
+    rows(std::max(1, static_cast<int>(std::ceil(worldHeight / size)))),
+    currentStamp(0) {
+    cellStart.assign(columns * rows + 1, 0);
+}
+
+/**
+ * Maps an unbounded column index onto the grid
+ * Uses a positive modulo so negative coordinates wrap to the right edge
+ * @param column Column index that may lie outside the grid
+ * @return Column index in range [0, columns)
+ */
+int SpatialGrid::WrapColumn(int column) const {
+    int wrapped = column % columns;
+    return wrapped < 0 ? wrapped + columns : wrapped;
+}
+
+/**
+ * Maps an unbounded row index onto the grid
+ * Uses a positive modulo so negative coordinates wrap to the bottom edge
+ * @param row Row index that may lie outside the grid
+ * @return Row index in range [0, rows)
+ */
+int SpatialGrid::WrapRow(int row) const {
+    int wrapped = row % rows;
+    return wrapped < 0 ? wrapped + rows : wrapped;
+}
+
+/**
+ * Computes the unwrapped cell range covered by a rectangle
+ * Ranges wider than the grid are clamped so every cell is visited once
+ * @param bounds Rectangle to convert into cell coordinates
+ * @param firstColumn Receives the first (unwrapped) column
+ * @param lastColumn Receives the last (unwrapped) column
+ * @param firstRow Receives the first (unwrapped) row
+ * @param lastRow Receives the last (unwrapped) row
+ */
+void SpatialGrid::GetCellRange(Rectangle bounds, int& firstColumn, int& lastColumn,
+    int& firstRow, int& lastRow) const {
+    firstColumn = static_cast<int>(std::floor(bounds.x / cellSize));
+    lastColumn = static_cast<int>(std::floor((bounds.x + bounds.width) / cellSize));
+    firstRow = static_cast<int>(std::floor(bounds.y / cellSize));
+    lastRow = static_cast<int>(std::floor((bounds.y + bounds.height) / cellSize));
+
+    if (lastColumn - firstColumn >= columns) lastColumn = firstColumn + columns - 1;
+    if (lastRow - firstRow >= rows) lastRow = firstRow + rows - 1;
+}
+
+/**
+ * Pre-allocates the entry and stamp buffers for an expected item count
+ * Rebuilds within that size never reallocate
+ * @param itemCount Item ids to make room for
+ * @param cellsPerItem Cells a typical item overlaps
+ */
+void SpatialGrid::Reserve(int itemCount, int cellsPerItem) {
+    size_t entries = static_cast<size_t>(itemCount) * cellsPerItem;
+    pendingCells.reserve(entries);
+    pendingItems.reserve(entries);
+    cellItems.reserve(entries);
+    queryStamps.reserve(itemCount);
+}
+
+/**
+ * Removes all items from the grid
+ * Keeps allocated memory so rebuilding each frame does not hit the heap
+ */
+void SpatialGrid::Clear() {
+    pendingCells.clear();
+    pendingItems.clear();
+    cellItems.clear();
+    std::fill(cellStart.begin(), cellStart.end(), 0);
+}
+
+/**
+ * Registers an item in every cell its bounds overlap
+ * Items are only queryable after the next call to Build()
+ * @param id Caller-defined item id, usually an index into the caller's vector
+ * @param bounds Axis-aligned bounds of the item
+ */
+void SpatialGrid::Insert(int id, Rectangle bounds) {
+    AppendCells(id, bounds, pendingCells, pendingItems);
+
+    if (id >= static_cast<int>(queryStamps.size())) {
+        queryStamps.resize(id + 1, 0);
+    }
+}
+
+/**
+ * Appends one entry per cell the bounds overlap to a pair of lists
+ * @param id Item id
+ * @param bounds Axis-aligned bounds of the item
+ * @param cells Receives the cell indices
+ * @param items Receives the item id once per cell
+ */
+void SpatialGrid::AppendCells(int id, Rectangle bounds,
+    std::vector<int>& cells, std::vector<int>& items) const {
+    int firstColumn, lastColumn, firstRow, lastRow;
+    GetCellRange(bounds, firstColumn, lastColumn, firstRow, lastRow);
+
+    for (int row = firstRow; row <= lastRow; row++) {
+        int rowOffset = WrapRow(row) * columns;
+        for (int column = firstColumn; column <= lastColumn; column++) {
+            cells.push_back(rowOffset + WrapColumn(column));
+            items.push_back(id);
+        }
+    }
+}
+
+/**
+ * Clears the grid and rebuilds it from a bounds array in one call
+ * Fixed slices of item ids compute their cell lists in parallel; the lists
+ * are joined in slice order, so the grid is identical to inserting every
+ * item in id order followed by Build()
+ * @param bounds Bounds per item id, items with negative width are skipped
+ * @param count Number of item ids
+ * @param jobs Pool for the cell computation, or nullptr to run serially
+ */
+void SpatialGrid::Rebuild(const Rectangle* bounds, int count, JobSystem* jobs) {
+    Clear();
+
+    int sliceCount = (count + REBUILD_SLICE - 1) / REBUILD_SLICE;
+    if (!jobs || sliceCount <= 1) {
+        for (int id = 0; id < count; id++) {
+            if (bounds[id].width >= 0.0f) AppendCells(id, bounds[id], pendingCells, pendingItems);
+        }
+    }
+    else {
+        if (static_cast<int>(sliceCells.size()) < sliceCount) {
+            sliceCells.resize(sliceCount);
+            sliceItems.resize(sliceCount);
+        }
+
+        jobs->ParallelFor(0, sliceCount, 1, [&](int firstSlice, int lastSlice) {
+            for (int slice = firstSlice; slice < lastSlice; slice++) {
+                sliceCells[slice].clear();
+                sliceItems[slice].clear();
+                int last = std::min(count, (slice + 1) * REBUILD_SLICE);
+                for (int id = slice * REBUILD_SLICE; id < last; id++) {
+                    if (bounds[id].width >= 0.0f) AppendCells(id, bounds[id], sliceCells[slice], sliceItems[slice]);
+                }
+            }
+        });
+
+        for (int slice = 0; slice < sliceCount; slice++) {
+            pendingCells.insert(pendingCells.end(), sliceCells[slice].begin(), sliceCells[slice].end());
+            pendingItems.insert(pendingItems.end(), sliceItems[slice].begin(), sliceItems[slice].end());
+        }
+    }
+
+    if (count > static_cast<int>(queryStamps.size())) {
+        queryStamps.resize(count, 0);
+    }
+    Build();
+}
+
+/**
+ * Sorts all pending insertions into per-cell buckets
+ * Two-pass counting sort: count entries per cell, prefix-sum, then scatter
+ * Runs in O(cells + entries) with no per-cell allocations
+ */
+void SpatialGrid::Build() {
+    int cellCount = columns * rows;
+
+    // Count entries per cell (shifted by one for the prefix sum)
+    for (int cell : pendingCells) {
+        cellStart[cell + 1]++;
+    }
+    for (int cell = 0; cell < cellCount; cell++) {
+        cellStart[cell + 1] += cellStart[cell];
+    }
+
+    // Scatter items, using cellStart as the write cursor
+    cellItems.resize(pendingItems.size());
+    for (size_t i = 0; i < pendingItems.size(); i++) {
+        cellItems[cellStart[pendingCells[i]]++] = pendingItems[i];
+    }
+
+    // Cursors now point at the next cell's start - shift back by one
+    for (int cell = cellCount; cell > 0; cell--) {
+        cellStart[cell] = cellStart[cell - 1];
+    }
+    cellStart[0] = 0;
+}
+
+/**
+ * Collects the ids of all items whose cells overlap the given area
+ * Results are a conservative candidate list - callers still run the exact test
+ * Each id is reported at most once per query
+ * @param bounds Area to search
+ * @param results Output list, cleared before filling
+ */
+void SpatialGrid::Query(Rectangle bounds, std::vector<int>& results) {
+    results.clear();
+
+    // Restart stamps before the counter overflows
+    if (currentStamp == INT_MAX) {
+        std::fill(queryStamps.begin(), queryStamps.end(), 0);
+        currentStamp = 0;
+    }
+    currentStamp++;
+
+    int firstColumn, lastColumn, firstRow, lastRow;
+    GetCellRange(bounds, firstColumn, lastColumn, firstRow, lastRow);
+
+    for (int row = firstRow; row <= lastRow; row++) {
+        int rowOffset = WrapRow(row) * columns;
+        for (int column = firstColumn; column <= lastColumn; column++) {
+            int cell = rowOffset + WrapColumn(column);
+            for (int i = cellStart[cell]; i < cellStart[cell + 1]; i++) {
+                int id = cellItems[i];
+                if (queryStamps[id] != currentStamp) {
+                    queryStamps[id] = currentStamp;
+                    results.push_back(id);
+                }
+            }
+        }
+    }
+}
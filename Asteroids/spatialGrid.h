@@ -0,0 +1,62 @@
+#ifndef SPATIALGRID_H
+#define SPATIALGRID_H
+
+#include <vector>
+#include "raylib.h"
+
+class JobSystem;
+
+/**
+ * SpatialGrid class implementing a uniform-grid spatial hash for broadphase collision
+ * Rebuilt every frame from the object vectors using a two-pass counting sort
+ * Cell coordinates wrap around the world size so objects sitting on the
+ * screen-wrap seam (asteroids live in [-radius, SCREEN + radius]) are never lost
+ */
+class SpatialGrid {
+private:
+    float cellSize;                     // Edge length of one grid cell in pixels
+    int columns;                        // Number of cells along the x axis
+    int rows;                           // Number of cells along the y axis
+    std::vector<int> cellStart;         // Prefix offsets into cellItems (columns * rows + 1 entries)
+    std::vector<int> cellItems;         // Item ids sorted by cell after Build()
+    std::vector<int> pendingCells;      // Cell index of every insertion before Build()
+    std::vector<int> pendingItems;      // Item id of every insertion before Build()
+    std::vector<int> queryStamps;       // Last query stamp per item id, used to skip duplicates
+    int currentStamp;                   // Stamp of the query currently being answered
+    std::vector<std::vector<int>> sliceCells;   // Per-slice cell lists of a parallel rebuild
+    std::vector<std::vector<int>> sliceItems;   // Per-slice item lists of a parallel rebuild
+    static const int REBUILD_SLICE = 2048;      // Items per slice of a parallel rebuild
+
+    int WrapColumn(int column) const;
+    int WrapRow(int row) const;
+    void GetCellRange(Rectangle bounds, int& firstColumn, int& lastColumn,
+        int& firstRow, int& lastRow) const;
+    void AppendCells(int id, Rectangle bounds,
+        std::vector<int>& cells, std::vector<int>& items) const;
+
+public:
+    SpatialGrid(float size /* Cell edge length in pixels */,
+        float worldWidth /* Width of the wrapping world in pixels */,
+        float worldHeight /* Height of the wrapping world in pixels */);
+
+    void Reserve(int itemCount /* Item ids to make room for */,
+        int cellsPerItem /* Cells a typical item overlaps */);
+    void Clear();
+    void Insert(int id /* Caller-defined item id (index into the caller's vector) */,
+        Rectangle bounds /* Axis-aligned bounds of the item */);
+    void Build();
+    void Rebuild(const Rectangle* bounds /* Bounds per item id, negative width = skip */,
+        int count /* Number of item ids */,
+        JobSystem* jobs /* Pool for the cell computation, or nullptr */);
+    void Query(Rectangle bounds /* Area to search */,
+        std::vector<int>& results /* Output list, cleared before filling */);
+
+    int GetCellCount() const {
+        return columns * rows;
+    }
+    int GetEntryCount() const {
+        return static_cast<int>(cellItems.size());
+    }
+};
+
+#endif
@@ -0,0 +1,158 @@
+#include "textCache.h"
+
+/**
+ * Constructor for TextLayout class
+ * Starts empty - nothing is drawn until Set() is called
+ */
+TextLayout::TextLayout() :
+    fontSize(0),
+    width(0),
+    useFallback(true),
+    fontReady(false) {
+}
+
+/**
+ * Lays out a string with the default font, unless it is already laid out
+ * Mirrors DrawText(): sizes below 10 are raised to 10 and the glyph spacing
+ * is fontSize / 10, so the cached quads land on the same pixels
+ * @param newText String to lay out
+ * @param size Font size in pixels
+ */
+void TextLayout::Set(const char* newText, int size) {
+    if (fontReady && fontSize == size && text == newText) return;
+
+    text = newText;
+    fontSize = size;
+    width = MeasureText(newText, size);
+    quads.clear();
+    useFallback = true;
+
+    Font font = GetFontDefault();
+    fontReady = font.texture.id != 0 && font.recs != nullptr;
+    if (!fontReady) return;
+
+    int drawSize = size < 10 ? 10 : size;
+    float scale = (float)drawSize / (float)font.baseSize;
+    float spacing = (float)(drawSize / 10);
+    float padding = (float)font.glyphPadding;
+    float offsetX = 0.0f;
+
+    for (int i = 0; newText[i] != '\0';) {
+        int bytes = 0;
+        int codepoint = GetCodepointNext(&newText[i], &bytes);
+        int index = GetGlyphIndex(font, codepoint);
+
+        // Line breaks depend on raylib's line spacing - leave them to DrawText()
+        if (codepoint == '\n') {
+            quads.clear();
+            return;
+        }
+
+        const Rectangle& rec = font.recs[index];
+        const GlyphInfo& glyph = font.glyphs[index];
+
+        if (codepoint != ' ' && codepoint != '\t') {
+            GlyphQuad quad;
+            quad.source = { rec.x - padding, rec.y - padding, rec.width + 2.0f * padding, rec.height + 2.0f * padding };
+            quad.dest = {
+                offsetX + glyph.offsetX * scale - padding * scale,
+                glyph.offsetY * scale - padding * scale,
+                (rec.width + 2.0f * padding) * scale,
+                (rec.height + 2.0f * padding) * scale
+            };
+            quads.push_back(quad);
+        }
+
+        offsetX += (glyph.advanceX == 0 ? rec.width * scale : glyph.advanceX * scale) + spacing;
+        i += bytes > 0 ? bytes : 1;
+    }
+
+    useFallback = false;
+}
+
+/**
+ * Draws the laid-out string at a screen position
+ * @param x Left edge on screen
+ * @param y Top edge on screen
+ * @param color Text tint
+ */
+void TextLayout::Draw(int x, int y, Color color) const {
+    if (useFallback) {
+        DrawText(text.c_str(), x, y, fontSize, color);
+        return;
+    }
+
+    Texture2D atlas = GetFontDefault().texture;
+    for (const GlyphQuad& quad : quads) {
+        Rectangle dest = { x + quad.dest.x, y + quad.dest.y, quad.dest.width, quad.dest.height };
+        DrawTexturePro(atlas, quad.source, dest, { 0.0f, 0.0f }, 0.0f, color);
+    }
+}
+
+/**
+ * Constructor for TextCache class
+ */
+TextCache::TextCache() :
+    entryCount(0) {
+    lookupKey.reserve(64);
+}
+
+/**
+ * Returns the cached layout of a string, laying it out on first use
+ * @param text String to look up
+ * @param fontSize Font size in pixels
+ * @return Layout valid until the next Clear()
+ */
+const TextLayout& TextCache::Get(const char* text, int fontSize) {
+    auto& sizeLayouts = layouts[fontSize];
+
+    lookupKey.assign(text);
+    auto found = sizeLayouts.find(lookupKey);
+    if (found != sizeLayouts.end()) {
+        // Laid out before the window existed - redo with the real font
+        if (!found->second.IsFontReady()) {
+            found->second.Set(text, fontSize);
+        }
+        return found->second;
+    }
+
+    // Callers passing formatted strings would otherwise grow the cache forever
+    if (entryCount >= MAX_ENTRIES) {
+        Clear();
+    }
+
+    TextLayout& layout = layouts[fontSize][lookupKey];
+    layout.Set(text, fontSize);
+    entryCount++;
+    return layout;
+}
+
+/**
+ * Cached replacement for MeasureText()
+ * @param text String to measure
+ * @param fontSize Font size in pixels
+ * @return Text width in pixels
+ */
+int TextCache::Measure(const char* text, int fontSize) {
+    return Get(text, fontSize).GetWidth();
+}
+
+/**
+ * Cached replacement for DrawText()
+ * @param text String to draw
+ * @param x Left edge on screen
+ * @param y Top edge on screen
+ * @param fontSize Font size in pixels
+ * @param color Text tint
+ */
+void TextCache::Draw(const char* text, int x, int y, int fontSize, Color color) {
+    Get(text, fontSize).Draw(x, y, color);
+}
+
+/**
+ * Drops every cached layout
+ */
+void TextCache::Clear() {
+    layouts.clear();
+    entryCount = 0;
+}
@@ -0,0 +1,72 @@
+#ifndef TEXTCACHE_H
+#define TEXTCACHE_H
+
+#include "raylib.h"
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * One glyph of a laid-out string in the default font atlas
+ */
+struct GlyphQuad {
+    Rectangle source;   // Glyph rectangle in the font texture
+    Rectangle dest;     // Screen rectangle relative to the text origin
+};
+
+/**
+ * TextLayout class holding a string laid out once with the default font
+ * Stores the measured width and one textured quad per visible glyph,
+ * so drawing skips codepoint decoding and glyph lookups
+ * Layout matches DrawText() / MeasureText() exactly
+ */
+class TextLayout {
+private:
+    std::string text;               // Laid-out string
+    int fontSize;                   // Font size the string was laid out at
+    int width;                      // Width as returned by MeasureText()
+    std::vector<GlyphQuad> quads;   // Visible glyphs (spaces and tabs are skipped)
+    bool useFallback;               // Font not ready or multi-line text - draw with DrawText()
+    bool fontReady;                 // Whether the default font was loaded when laid out
+
+public:
+    TextLayout();
+
+    void Set(const char* newText /* String to lay out */,
+        int size /* Font size in pixels */);
+    void Draw(int x /* Left edge on screen */,
+        int y /* Top edge on screen */,
+        Color color /* Text tint */) const;
+
+    const std::string& GetText() const { return text; }
+    int GetFontSize() const { return fontSize; }
+    int GetWidth() const { return width; }
+    bool IsFontReady() const { return fontReady; }
+};
+
+/**
+ * TextCache class remembering laid-out strings keyed by (string, font size)
+ * Intended for constant labels that are measured and drawn every frame
+ * Values that change over time should own a TextLayout instead
+ * The cache is cleared when it grows past MAX_ENTRIES as a safety net
+ */
+class TextCache {
+private:
+    static const int MAX_ENTRIES = 512;
+
+    std::unordered_map<int, std::unordered_map<std::string, TextLayout>> layouts; // Per font size
+    std::string lookupKey;          // Reused lookup buffer, avoids an allocation per call
+    int entryCount;                 // Total number of cached layouts
+
+public:
+    TextCache();
+
+    const TextLayout& Get(const char* text /* String to look up */,
+        int fontSize /* Font size in pixels */);
+    int Measure(const char* text, int fontSize);
+    void Draw(const char* text, int x, int y, int fontSize, Color color);
+    void Clear();
+    int GetEntryCount() const { return entryCount; }
+};
+
+#endif
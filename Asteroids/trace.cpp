@@ -0,0 +1,233 @@
+#include "trace.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Session state, owned by the thread calling Start/Stop
+static std::atomic<bool> active(false);
+static std::chrono::steady_clock::time_point sessionStart;
+static FILE* output = nullptr;
+static std::thread writer;
+
+// Producer buffer, swapped with the writer's buffer under the mutex
+static std::mutex bufferMutex;
+static std::condition_variable wakeWriter;
+static std::vector<TraceEvent> pending;
+static bool stopRequested = false;
+static int droppedEvents = 0;
+
+// Trace ids of the threads that emitted events or were named, guarded by
+// bufferMutex; a thread's id is its index in threadNames plus one
+static std::vector<const char*> threadNames;
+static thread_local int threadId = 0;
+
+/**
+ * Converts a time point to microseconds since the session start
+ * @param time Time point to convert
+ * @return Trace timestamp in microseconds
+ */
+static double ToMicroseconds(std::chrono::steady_clock::time_point time) {
+    return std::chrono::duration<double, std::micro>(time - sessionStart).count();
+}
+
+/**
+ * Gets the trace id of the calling thread, registering it on first use
+ * Call with bufferMutex held
+ * @return Trace id, starting at 1
+ */
+static int GetThreadId() {
+    if (threadId == 0) {
+        threadNames.push_back(nullptr);
+        threadId = static_cast<int>(threadNames.size());
+    }
+    return threadId;
+}
+
+/**
+ * Queues an event of the calling thread for the writer thread
+ * Never blocks on file I/O; events are dropped while the buffer is full
+ * The timestamp is converted under the lock, so a concurrent Start()
+ * never hands out a half-written session start
+ * @param name Event name
+ * @param phase Chrome trace phase
+ * @param time Time of the event
+ * @param value Duration in microseconds ('X') or counter value ('C')
+ */
+static void Push(const char* name, char phase, std::chrono::steady_clock::time_point time, double value) {
+    std::lock_guard<std::mutex> lock(bufferMutex);
+    if (pending.size() >= TRACE_BUFFER_EVENTS) {
+        droppedEvents++;
+        return;
+    }
+    pending.push_back({ name, phase, GetThreadId(), ToMicroseconds(time), value });
+}
+
+/**
+ * Writes a batch of events as JSON array elements
+ * @param events Events to write
+ */
+static void WriteEvents(const std::vector<TraceEvent>& events) {
+    for (const TraceEvent& event : events) {
+        switch (event.phase) {
+        case 'X':
+            fprintf(output, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%d}",
+                event.name, event.timestamp, event.value, event.thread);
+            break;
+        case 'C':
+            fprintf(output, ",\n{\"name\":\"%s\",\"ph\":\"C\",\"ts\":%.3f,\"pid\":1,\"tid\":%d,\"args\":{\"value\":%g}}",
+                event.name, event.timestamp, event.thread, event.value);
+            break;
+        default:
+            fprintf(output, ",\n{\"name\":\"%s\",\"ph\":\"i\",\"s\":\"g\",\"ts\":%.3f,\"pid\":1,\"tid\":%d}",
+                event.name, event.timestamp, event.thread);
+            break;
+        }
+    }
+}
+
+/**
+ * Writer thread: swaps out the producer buffer every few milliseconds and
+ * writes it to disk, so the game thread only ever pays for a vector push
+ */
+static void WriterLoop() {
+    std::vector<TraceEvent> batch;
+    batch.reserve(TRACE_BUFFER_EVENTS);
+
+    bool stopping = false;
+    while (!stopping) {
+        {
+            std::unique_lock<std::mutex> lock(bufferMutex);
+            wakeWriter.wait_for(lock, std::chrono::milliseconds(50), [] { return stopRequested; });
+            stopping = stopRequested;
+            batch.swap(pending);
+        }
+        WriteEvents(batch);
+        batch.clear();
+    }
+}
+
+namespace Trace {
+
+    /**
+     * Opens a trace file and starts the writer thread
+     * @param path Output JSON file
+     * @return False if a session is already running or the file cannot be opened
+     */
+    bool Start(const char* path) {
+        if (active) return false;
+
+        output = fopen(path, "w");
+        if (!output) return false;
+
+        // Metadata first, so every later event can be written with a leading comma
+        fprintf(output, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+        fprintf(output, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"Asteroids\"}}");
+
+        // A producer that saw the previous session as active may still be
+        // inside Push()
+        {
+            std::lock_guard<std::mutex> lock(bufferMutex);
+            pending.clear();
+            pending.reserve(TRACE_BUFFER_EVENTS);
+            stopRequested = false;
+            droppedEvents = 0;
+            sessionStart = std::chrono::steady_clock::now();
+        }
+
+        writer = std::thread(WriterLoop);
+        active = true;
+        return true;
+    }
+
+    /**
+     * Flushes all queued events, names every thread track and closes the
+     * JSON document and the file
+     * Does nothing if no session is running
+     */
+    void Stop() {
+        if (!active) return;
+        active = false;
+
+        {
+            std::lock_guard<std::mutex> lock(bufferMutex);
+            stopRequested = true;
+        }
+        wakeWriter.notify_one();
+        writer.join();
+
+        std::lock_guard<std::mutex> lock(bufferMutex);
+        for (size_t i = 0; i < threadNames.size(); i++) {
+            fprintf(output, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"",
+                (int)i + 1);
+            if (threadNames[i]) fprintf(output, "%s\"}}", threadNames[i]);
+            else fprintf(output, "Thread %d\"}}", (int)i + 1);
+        }
+        if (droppedEvents > 0) {
+            fprintf(output, ",\n{\"name\":\"dropped_events\",\"ph\":\"M\",\"pid\":1,\"args\":{\"count\":%d}}", droppedEvents);
+        }
+        fprintf(output, "\n]}\n");
+        fclose(output);
+        output = nullptr;
+    }
+
+    /**
+     * Checks whether a trace session is running
+     * @return True between Start and Stop
+     */
+    bool IsActive() {
+        return active.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Names the calling thread's track in the trace viewer
+     * Threads that are never named show up as "Thread <id>"
+     * @param name Track name, must outlive every trace session
+     */
+    void SetThreadName(const char* name) {
+        std::lock_guard<std::mutex> lock(bufferMutex);
+        threadNames[GetThreadId() - 1] = name;
+    }
+
+    /**
+     * Records a timed zone as a complete ('X') event
+     * @param name Zone name
+     * @param start Zone entry
+     * @param end Zone exit
+     */
+    void Zone(const char* name, std::chrono::steady_clock::time_point start,
+        std::chrono::steady_clock::time_point end) {
+        if (!IsActive()) return;
+        Push(name, 'X', start, std::chrono::duration<double, std::micro>(end - start).count());
+    }
+
+    /**
+     * Records the current value of a counter track
+     * @param name Counter track name
+     * @param value Current value
+     */
+    void Counter(const char* name, double value) {
+        if (!IsActive()) return;
+        Push(name, 'C', std::chrono::steady_clock::now(), value);
+    }
+
+    /**
+     * Records a global instant marker, e.g. a frame boundary
+     * @param name Marker name
+     */
+    void Instant(const char* name) {
+        if (!IsActive()) return;
+        Push(name, 'i', std::chrono::steady_clock::now(), 0.0);
+    }
+
+    /**
+     * Gets the number of events dropped because the buffer was full
+     * @return Dropped events in the current or last session
+     */
+    int GetDroppedEvents() {
+        std::lock_guard<std::mutex> lock(bufferMutex);
+        return droppedEvents;
+    }
+}
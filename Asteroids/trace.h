@@ -0,0 +1,38 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <chrono>
+
+#define TRACE_BUFFER_EVENTS 65536   // Events buffered between two writer flushes before dropping
+
+/**
+ * One buffered trace event
+ * Names must be string literals or otherwise outlive the trace session
+ */
+struct TraceEvent {
+    const char* name;       // Event name shown in the trace viewer
+    char phase;             // Chrome trace phase: 'X' complete, 'C' counter, 'i' instant
+    int thread;             // Trace id of the emitting thread, written as tid
+    double timestamp;       // Microseconds since Trace::Start
+    double value;           // Duration in microseconds ('X') or counter value ('C')
+};
+
+// Chrome trace-event JSON export, written by a background thread
+// Load the file in chrome://tracing or ui.perfetto.dev
+namespace Trace {
+    bool Start(const char* path /* Output JSON file */);
+    void Stop();
+    bool IsActive();
+    void SetThreadName(const char* name /* Track name of the calling thread */);
+
+    void Zone(const char* name /* Zone name */,
+        std::chrono::steady_clock::time_point start /* Zone entry */,
+        std::chrono::steady_clock::time_point end /* Zone exit */);
+    void Counter(const char* name /* Counter track name */,
+        double value /* Current value */);
+    void Instant(const char* name /* Marker name */);
+
+    int GetDroppedEvents();
+}
+
+#endif
@@ -2,28 +2,33 @@
 #include "raymath.h"
 #include "globals.h"
 #include "highscoreManager.h"
+#include "profiler.h"
+#include "random.h"
 
 /**
  * Constructor for UIRenderer class
- * Initializes references to game systems and state managers
- * Sets up dependencies for rendering different UI screens
- * @param stateMgr Reference to game state manager
- * @param score Reference to game score system
- * @param ship Reference to player spaceship
- * @param objMgr Reference to object manager
- * @param currentItemRef Reference to current power-up item
+ * The renderer keeps no references into the simulation; every frame draws
+ * from the render snapshot passed to DrawCurrentState()
+ * Formatted text is taken from the frame arena set by SetFrameArena()
  */
-UIRenderer::UIRenderer(GameStateManager& stateMgr, Score& score, Spaceship& ship, ObjectManager& objMgr, int& currentItemRef) :
-    stateManager(stateMgr), gameScore(score), player(ship), objectManager(objMgr), currentItem(currentItemRef) {
+UIRenderer::UIRenderer() :
+    frame(nullptr),
+    frameArena(nullptr),
+    drawAllocations(0),
+    effects(DeriveStreamSeed(0, RANDOM_EFFECTS)) {
 }
 
 /**
  * Main rendering dispatcher method
  * Routes rendering to appropriate state-specific methods
  * Provides fallback to main menu for unknown states
+ * @param snapshot Simulation state to draw, kept until the call returns
  */
-void UIRenderer::DrawCurrentState() const {
-    switch (stateManager.GetCurrentState()) {
+void UIRenderer::DrawCurrentState(const RenderSnapshot& snapshot) const {
+    PROFILE_SCOPE(ZONE_DRAW);
+    frame = &snapshot;
+
+    switch (frame->stateManager.GetCurrentState()) {
     case MAIN_MENU:
         DrawMainMenu();
         break;
@@ -49,14 +54,31 @@ void UIRenderer::DrawCurrentState() const {
         DrawMainMenu();
         break;
     }
+
+    if (Profiler::IsOverlayVisible()) {
+        DrawProfilerOverlay();
+    }
 }
 
 /**
- * Draws a checkered grid background pattern
- * Creates a white background with light gray grid lines
+ * Draws the checkered grid background from the background cache
+ * The grid is recorded into a render texture once and blitted as one quad
  * Used as background for in-game state
  */
 void UIRenderer::DrawCheckeredBackground() const {
+    if (backgroundCache.BeginRecording(GAME_GRID_LAYER)) {
+        DrawCheckeredGrid();
+        backgroundCache.EndRecording();
+    }
+    backgroundCache.Draw(GAME_GRID_LAYER);
+}
+
+/**
+ * Draws a checkered grid background pattern
+ * Creates a white background with light gray grid lines
+ * Recorded into the background cache by DrawCheckeredBackground()
+ */
+void UIRenderer::DrawCheckeredGrid() const {
     ClearBackground(WHITE);
 
     // Vertical lines
@@ -98,22 +120,22 @@ void UIRenderer::DrawMainMenu() const {
     const char* title = "ASTEROIDS";
     int titleSize = 50;
     float titlePulse = 1.0f + 0.1f * sinf(animTime * 2.0f); // Light pulsing
-    int titleWidth = MeasureText(title, (int)(titleSize * titlePulse));
+    int titleWidth = textCache.Measure(title, (int)(titleSize * titlePulse));
 
     // Title shadow for 3D effect
-    DrawText(title, SCREEN_WIDTH / 2 - titleWidth / 2 + 3, 50 + 3, (int)(titleSize * titlePulse), Color{ 100, 100, 100, 255 });
-    DrawText(title, SCREEN_WIDTH / 2 - titleWidth / 2, 50, (int)(titleSize * titlePulse), BLACK);
+    textCache.Draw(title, SCREEN_WIDTH / 2 - titleWidth / 2 + 3, 50 + 3, (int)(titleSize * titlePulse), Color{ 100, 100, 100, 255 });
+    textCache.Draw(title, SCREEN_WIDTH / 2 - titleWidth / 2, 50, (int)(titleSize * titlePulse), BLACK);
 
     // Subtitle with animation
     const char* subtitle = "Classic Space Shooter - MS Paint Edition";
-    int subtitleWidth = MeasureText(subtitle, 18);
+    int subtitleWidth = textCache.Measure(subtitle, 18);
     float subtitleFloat = sinf(animTime * 1.5f) * 3.0f; // Gentle floating
-    DrawText(subtitle, SCREEN_WIDTH / 2 - subtitleWidth / 2, (int)(95 + subtitleFloat), 18, Color{ 80, 80, 80, 255 });
+    textCache.Draw(subtitle, SCREEN_WIDTH / 2 - subtitleWidth / 2, (int)(95 + subtitleFloat), 18, Color{ 80, 80, 80, 255 });
 
     // Creator credit
     const char* creator = "Created by Adrian Kranyak";
-    int creatorWidth = MeasureText(creator, 14);
-    DrawText(creator, SCREEN_WIDTH / 2 - creatorWidth / 2, 115, 14, Color{ 120, 60, 160, 255 }); // Purple color
+    int creatorWidth = textCache.Measure(creator, 14);
+    textCache.Draw(creator, SCREEN_WIDTH / 2 - creatorWidth / 2, 115, 14, Color{ 120, 60, 160, 255 }); // Purple color
 
     // Menu area
     DrawRectangle(50, 160, SCREEN_WIDTH - 100, 300, Color{ 240, 240, 240, 255 });
@@ -138,7 +160,7 @@ void UIRenderer::DrawMainMenu() const {
         int itemX = SCREEN_WIDTH / 2 - menuItemWidth / 2;
 
         // Button animation on selection
-        bool isSelected = (i == stateManager.GetMenuSelection());
+        bool isSelected = (i == frame->stateManager.GetMenuSelection());
         float buttonPulse = isSelected ? 1.0f + 0.15f * sinf(animTime * 8.0f) : 1.0f;
         int buttonOffset = isSelected ? (int)(sinf(animTime * 6.0f) * 2.0f) : 0;
 
@@ -163,8 +185,8 @@ void UIRenderer::DrawMainMenu() const {
         // Button text
         Color textColor = isSelected ? BLACK : Color{ 60, 60, 60, 255 };
         int textSize = isSelected ? 26 : 24;
-        int textWidth = MeasureText(items[i], textSize);
-        DrawText(items[i], itemX + (menuItemWidth - textWidth) / 2 + buttonOffset, itemY + 13 + buttonOffset, textSize, textColor);
+        int textWidth = textCache.Measure(items[i], textSize);
+        textCache.Draw(items[i], itemX + (menuItemWidth - textWidth) / 2 + buttonOffset, itemY + 13 + buttonOffset, textSize, textColor);
     }
 
     // Game preview background area
@@ -175,8 +197,8 @@ void UIRenderer::DrawMainMenu() const {
 
     // Preview title
     const char* previewTitle = "GAME PREVIEW";
-    int previewTitleWidth = MeasureText(previewTitle, 20);
-    DrawText(previewTitle, SCREEN_WIDTH / 2 - previewTitleWidth / 2, previewAreaY + 10, 20, Color{ 80, 80, 80, 255 });
+    int previewTitleWidth = textCache.Measure(previewTitle, 20);
+    textCache.Draw(previewTitle, SCREEN_WIDTH / 2 - previewTitleWidth / 2, previewAreaY + 10, 20, Color{ 80, 80, 80, 255 });
 
     // Organized game elements in sections
     int sectionY = previewAreaY + 40;
@@ -216,8 +238,8 @@ void UIRenderer::DrawMainMenu() const {
 
     for (int i = 0; i < 5; i++) {
         Vector2 particle = {
-            thrustBase.x + thrustDir.x * (15 + i * 3) + GetRandomValue(-2, 2),
-            thrustBase.y + thrustDir.y * (15 + i * 3) + GetRandomValue(-2, 2)
+            thrustBase.x + thrustDir.x * (15 + i * 3) + effects.Range(-2, 2),
+            thrustBase.y + thrustDir.y * (15 + i * 3) + effects.Range(-2, 2)
         };
         Color particleColor = (i % 2 == 0) ? ORANGE : RED;
         particleColor.a = 255 - i * 40;
@@ -226,8 +248,8 @@ void UIRenderer::DrawMainMenu() const {
 
     // Spaceship label
     const char* shipLabel = "SPACESHIP";
-    int shipLabelWidth = MeasureText(shipLabel, 12);
-    DrawText(shipLabel, shipCenterX - shipLabelWidth / 2, sectionY + sectionHeight - 20, 12, BLACK);
+    int shipLabelWidth = textCache.Measure(shipLabel, 12);
+    textCache.Draw(shipLabel, shipCenterX - shipLabelWidth / 2, sectionY + sectionHeight - 20, 12, BLACK);
 
     // Middle section: Asteroids demonstration
     int middleSectionX = leftSectionX + leftSectionWidth + 10;
@@ -269,8 +291,8 @@ void UIRenderer::DrawMainMenu() const {
 
     // Asteroids label
     const char* astLabel = "ASTEROIDS";
-    int astLabelWidth = MeasureText(astLabel, 12);
-    DrawText(astLabel, asteroidCenterX - astLabelWidth / 2, sectionY + sectionHeight - 20, 12, BLACK);
+    int astLabelWidth = textCache.Measure(astLabel, 12);
+    textCache.Draw(astLabel, asteroidCenterX - astLabelWidth / 2, sectionY + sectionHeight - 20, 12, BLACK);
 
     // Right section: Power-ups demonstration
     int rightSectionX = middleSectionX + middleSectionWidth + 10;
@@ -298,19 +320,19 @@ void UIRenderer::DrawMainMenu() const {
         DrawRectangleLines(powerUpX - 25, powerUpY - 10, 50, 20, BLACK);
 
         // Power-up text
-        int textWidth = MeasureText(powerUpLabels[i], 10);
-        DrawText(powerUpLabels[i], powerUpX - textWidth / 2, powerUpY - 5, 10, WHITE);
+        int textWidth = textCache.Measure(powerUpLabels[i], 10);
+        textCache.Draw(powerUpLabels[i], powerUpX - textWidth / 2, powerUpY - 5, 10, WHITE);
 
         // Gentle glow effect
         if ((int)(animTime * 3.0f + i) % 6 == 0) {
-            DrawPixel(powerUpX + GetRandomValue(-30, 30), powerUpY + GetRandomValue(-15, 15), YELLOW);
+            DrawPixel(powerUpX + effects.Range(-30, 30), powerUpY + effects.Range(-15, 15), YELLOW);
         }
     }
 
     // Power-ups label
     const char* powerLabel = "POWER-UPS";
-    int powerLabelWidth = MeasureText(powerLabel, 12);
-    DrawText(powerLabel, rightSectionX + rightSectionWidth / 2 - powerLabelWidth / 2, sectionY + sectionHeight - 20, 12, BLACK);
+    int powerLabelWidth = textCache.Measure(powerLabel, 12);
+    textCache.Draw(powerLabel, rightSectionX + rightSectionWidth / 2 - powerLabelWidth / 2, sectionY + sectionHeight - 20, 12, BLACK);
 
     // Projectiles flying across sections (connecting element)
     for (int i = 0; i < 2; i++) {
@@ -333,13 +355,13 @@ void UIRenderer::DrawMainMenu() const {
     DrawRectangleLines(20, SCREEN_HEIGHT - 70, SCREEN_WIDTH - 40, 50, BLACK);
 
     const char* controls = "Use UP/DOWN arrows or W/S to navigate, ENTER to select, ESC to quit";
-    int controlsWidth = MeasureText(controls, 14);
-    DrawText(controls, SCREEN_WIDTH / 2 - controlsWidth / 2, SCREEN_HEIGHT - 55, 14, Color{ 80, 80, 80, 255 });
+    int controlsWidth = textCache.Measure(controls, 14);
+    textCache.Draw(controls, SCREEN_WIDTH / 2 - controlsWidth / 2, SCREEN_HEIGHT - 55, 14, Color{ 80, 80, 80, 255 });
 
     // Version info (inside the control box, properly spaced)
     const char* version = "v1.0 - Asteroids MS Paint Edition";
-    int versionWidth = MeasureText(version, 12);
-    DrawText(version, SCREEN_WIDTH / 2 - versionWidth / 2, SCREEN_HEIGHT - 35, 12, Color{ 120, 120, 120, 255 });
+    int versionWidth = textCache.Measure(version, 12);
+    textCache.Draw(version, SCREEN_WIDTH / 2 - versionWidth / 2, SCREEN_HEIGHT - 35, 12, Color{ 120, 120, 120, 255 });
 }
 
 /**
@@ -361,27 +383,26 @@ void UIRenderer::DrawInGame() const {
  * Renders all active game objects
  * Draws spaceship, projectiles, asteroids, and power-ups
  * Only renders objects that are currently active
+ * Moving objects are drawn between their last two simulation states
+ * using the interpolation factor set by the fixed-step loop
  */
 void UIRenderer::DrawGameObjects() const {
     // Draw spaceship (with all effects like shield, if active)
-    player.Draw();
+    frame->player.Draw(effects, interpolationAlpha);
 
     // Draw all projectiles
-    for (const auto& projectile : objectManager.GetProjectiles()) {
-        if (projectile.IsActive()) {
-            projectile.Draw();
+    const ProjectileStore& projectiles = frame->projectiles;
+    for (int i = 0; i < projectiles.size(); i++) {
+        if (projectiles.IsAlive(i)) {
+            projectiles[i].Draw(interpolationAlpha);
         }
     }
 
-    // Draw all asteroids
-    for (const auto& asteroid : objectManager.GetAsteroids()) {
-        if (asteroid.IsActive()) {
-            asteroid.Draw();
-        }
-    }
+    // Draw all asteroids in one batch
+    asteroidRenderer.Draw(frame->asteroids, interpolationAlpha);
 
     // Draw power-ups
-    for (const auto& powerup : objectManager.GetPowerUps()) {
+    for (const auto& powerup : frame->powerups) {
         if (powerup.IsActive()) {
             powerup.Draw();
         }
@@ -400,29 +421,50 @@ void UIRenderer::DrawGameUI() const {
     DrawRectangle(5, 5, mainUIWidth, mainUIHeight, Color{ 0, 0, 0, 150 });
     DrawRectangleLines(5, 5, mainUIWidth, mainUIHeight, WHITE);
 
-    // Basic information
-    DrawText(TextFormat("SCORE: %d", gameScore.GetScore()), 15, 15, 20, WHITE);
-    DrawText(TextFormat("LIVES: %d", player.GetLives()), 15, 40, 20, WHITE);
-    DrawText(TextFormat("LEVEL: %d", gameScore.GetLevel()), 15, 65, 20, WHITE);
-    DrawText(TextFormat("HIGH: %d", gameScore.GetHighScore()), 15, 90, 20, YELLOW);
+    // Basic information (re-formatted only when a value changes)
+    UpdateHudField(scoreField, frame->score.GetScore(), "SCORE: %d", 20);
+    UpdateHudField(livesField, frame->player.GetLives(), "LIVES: %d", 20);
+    UpdateHudField(levelField, frame->score.GetLevel(), "LEVEL: %d", 20);
+    UpdateHudField(highScoreField, frame->score.GetHighScore(), "HIGH: %d", 20);
+    scoreField.layout.Draw(15, 15, WHITE);
+    livesField.layout.Draw(15, 40, WHITE);
+    levelField.layout.Draw(15, 65, WHITE);
+    highScoreField.layout.Draw(15, 90, YELLOW);
 
     // Item slot display (top right)
     DrawItemSlot();
 
     // Shield status display
-    if (player.IsShieldActive()) {
-        float timeRemaining = player.GetShieldTimeRemaining();
-        DrawText(TextFormat("SHIELD: %.1fs", timeRemaining), 15, 115, 16, BLUE);
+    if (frame->player.IsShieldActive()) {
+        // Tracked in tenths of a second, the precision that is displayed
+        int tenthsRemaining = (int)roundf(frame->player.GetShieldTimeRemaining() * 10.0f);
+        if (shieldField.Update(tenthsRemaining)) {
+            shieldField.layout.Set(frameArena->Format("SHIELD: %.1fs", tenthsRemaining / 10.0f), 16);
+        }
+        shieldField.layout.Draw(15, 115, BLUE);
     }
 
     // Invulnerability status display
-    if (player.IsInvulnerable()) {
-        int yOffset = player.IsShieldActive() ? 135 : 115; // Adjust position based on shield status
-        DrawText("INVULNERABLE", 15, yOffset, 16, YELLOW);
+    if (frame->player.IsInvulnerable()) {
+        int yOffset = frame->player.IsShieldActive() ? 135 : 115; // Adjust position based on shield status
+        textCache.Draw("INVULNERABLE", 15, yOffset, 16, YELLOW);
     }
 
     // Control hint (bottom right)
-    DrawText("SHIFT: Use Item", SCREEN_WIDTH - 120, SCREEN_HEIGHT - 25, 12, LIGHTGRAY);
+    textCache.Draw("SHIFT: Use Item", SCREEN_WIDTH - 120, SCREEN_HEIGHT - 25, 12, LIGHTGRAY);
+}
+
+/**
+ * Re-formats a numeric HUD field if its value changed since the last frame
+ * @param field Field to update
+ * @param value Current value
+ * @param format printf-style format with a single %d
+ * @param fontSize Font size in pixels
+ */
+void UIRenderer::UpdateHudField(HudField& field, int value, const char* format, int fontSize) const {
+    if (field.Update(value)) {
+        field.layout.Set(frameArena->Format(format, value), fontSize);
+    }
 }
 
 /**
@@ -441,51 +483,51 @@ void UIRenderer::DrawItemSlot() const {
     DrawRectangleLines(slotX, slotY, slotSize, slotSize, WHITE);
 
     // Slot title
-    DrawText("ITEM SLOT", slotX - 20, slotY - 15, 12, WHITE);
+    textCache.Draw("ITEM SLOT", slotX - 20, slotY - 15, 12, WHITE);
 
     // Display item content
-    if (currentItem > 0) {
+    if (frame->currentItem > 0) {
         // Item properties based on type
         const char* itemNames[] = { "", "RAPID", "SHIELD", "LIFE" };
         Color itemColors[] = { WHITE, RED, BLUE, GREEN };
 
-        if (currentItem >= 1 && currentItem <= 3) {
+        if (frame->currentItem >= 1 && frame->currentItem <= 3) {
             // Item background
-            Color bgColor = itemColors[currentItem];
+            Color bgColor = itemColors[frame->currentItem];
             bgColor.a = 150; // More visibility
             DrawRectangle(slotX + 5, slotY + 5, slotSize - 10, slotSize - 10, bgColor);
 
             // Item symbol/text (simple text since symbols can be problematic)
             const char* symbols[] = { "", "R", "S", "L" }; // Letters instead of symbols
-            int symbolWidth = MeasureText(symbols[currentItem], 32);
-            DrawText(symbols[currentItem],
+            int symbolWidth = textCache.Measure(symbols[frame->currentItem], 32);
+            textCache.Draw(symbols[frame->currentItem],
                 slotX + (slotSize - symbolWidth) / 2,
                 slotY + 15, 32, WHITE);
 
             // Item name
-            int nameWidth = MeasureText(itemNames[currentItem], 12);
-            DrawText(itemNames[currentItem],
+            int nameWidth = textCache.Measure(itemNames[frame->currentItem], 12);
+            textCache.Draw(itemNames[frame->currentItem],
                 slotX + (slotSize - nameWidth) / 2,
                 slotY + 50, 12, WHITE);
 
             // Activation hint
-            DrawText("SHIFT", slotX + (slotSize - MeasureText("SHIFT", 10)) / 2,
+            textCache.Draw("SHIFT", slotX + (slotSize - textCache.Measure("SHIFT", 10)) / 2,
                 slotY + 65, 10, YELLOW);
 
             // Pulsing border for active item
             static float pulseTimer = 0;
             pulseTimer += GetFrameTime();
             float pulse = 0.7f + 0.3f * sinf(pulseTimer * 5.0f);
-            Color pulseColor = itemColors[currentItem];
+            Color pulseColor = itemColors[frame->currentItem];
             pulseColor.a = (unsigned char)(255 * pulse);
             DrawRectangleLines(slotX + 2, slotY + 2, slotSize - 4, slotSize - 4, pulseColor);
         }
     }
     else {
         // Empty slot
-        DrawText("EMPTY", slotX + 20, slotY + 30, 12, GRAY);
-        DrawText("Collect", slotX + 15, slotY + 45, 10, GRAY);
-        DrawText("PowerUps", slotX + 12, slotY + 57, 10, GRAY);
+        textCache.Draw("EMPTY", slotX + 20, slotY + 30, 12, GRAY);
+        textCache.Draw("Collect", slotX + 15, slotY + 45, 10, GRAY);
+        textCache.Draw("PowerUps", slotX + 12, slotY + 57, 10, GRAY);
     }
 
     // Strengthen slot border
@@ -503,33 +545,33 @@ void UIRenderer::DrawGameOver() const {
 
     // Main text
     const char* gameOverText = "GAME OVER";
-    int gameOverWidth = MeasureText(gameOverText, 60);
-    DrawText(gameOverText, SCREEN_WIDTH / 2 - gameOverWidth / 2, SCREEN_HEIGHT / 2 - 100, 60, RED);
+    int gameOverWidth = textCache.Measure(gameOverText, 60);
+    textCache.Draw(gameOverText, SCREEN_WIDTH / 2 - gameOverWidth / 2, SCREEN_HEIGHT / 2 - 100, 60, RED);
 
     // Score information
-    const char* finalScore = TextFormat("FINAL SCORE: %d", gameScore.GetScore());
-    int scoreWidth = MeasureText(finalScore, 30);
-    DrawText(finalScore, SCREEN_WIDTH / 2 - scoreWidth / 2, SCREEN_HEIGHT / 2 - 20, 30, WHITE);
+    const char* finalScore = frameArena->Format("FINAL SCORE: %d", frame->score.GetScore());
+    int scoreWidth = textCache.Measure(finalScore, 30);
+    textCache.Draw(finalScore, SCREEN_WIDTH / 2 - scoreWidth / 2, SCREEN_HEIGHT / 2 - 20, 30, WHITE);
 
-    const char* highScore = TextFormat("HIGH SCORE: %d", gameScore.GetHighScore());
-    int highScoreWidth = MeasureText(highScore, 24);
-    DrawText(highScore, SCREEN_WIDTH / 2 - highScoreWidth / 2, SCREEN_HEIGHT / 2 + 20, 24, YELLOW);
+    const char* highScore = frameArena->Format("HIGH SCORE: %d", frame->score.GetHighScore());
+    int highScoreWidth = textCache.Measure(highScore, 24);
+    textCache.Draw(highScore, SCREEN_WIDTH / 2 - highScoreWidth / 2, SCREEN_HEIGHT / 2 + 20, 24, YELLOW);
 
     // New high score?
-    if (gameScore.GetScore() == gameScore.GetHighScore() && gameScore.GetScore() > 0) {
+    if (frame->score.GetScore() == frame->score.GetHighScore() && frame->score.GetScore() > 0) {
         const char* newRecord = "NEW HIGH SCORE!";
-        int recordWidth = MeasureText(newRecord, 20);
-        DrawText(newRecord, SCREEN_WIDTH / 2 - recordWidth / 2, SCREEN_HEIGHT / 2 + 60, 20, GREEN);
+        int recordWidth = textCache.Measure(newRecord, 20);
+        textCache.Draw(newRecord, SCREEN_WIDTH / 2 - recordWidth / 2, SCREEN_HEIGHT / 2 + 60, 20, GREEN);
     }
 
     // Instructions
     const char* instruction1 = "Press ENTER to return to menu";
-    int inst1Width = MeasureText(instruction1, 20);
-    DrawText(instruction1, SCREEN_WIDTH / 2 - inst1Width / 2, SCREEN_HEIGHT / 2 + 100, 20, LIGHTGRAY);
+    int inst1Width = textCache.Measure(instruction1, 20);
+    textCache.Draw(instruction1, SCREEN_WIDTH / 2 - inst1Width / 2, SCREEN_HEIGHT / 2 + 100, 20, LIGHTGRAY);
 
     const char* instruction3 = "Press ESC to quit";
-    int inst3Width = MeasureText(instruction3, 16);
-    DrawText(instruction3, SCREEN_WIDTH / 2 - inst3Width / 2, SCREEN_HEIGHT / 2 + 150, 16, GRAY);
+    int inst3Width = textCache.Measure(instruction3, 16);
+    textCache.Draw(instruction3, SCREEN_WIDTH / 2 - inst3Width / 2, SCREEN_HEIGHT / 2 + 150, 16, GRAY);
 }
 
 /**
@@ -538,6 +580,19 @@ void UIRenderer::DrawGameOver() const {
  * Organized in sections: Movement, Combat, Power-ups, Navigation, and Tips
  */
 void UIRenderer::DrawOptionsMenu() const {
+    if (backgroundCache.BeginRecording(OPTIONS_LAYER)) {
+        DrawOptionsContent();
+        backgroundCache.EndRecording();
+    }
+    backgroundCache.Draw(OPTIONS_LAYER);
+}
+
+/**
+ * Draws the complete controls screen
+ * The screen has no animated parts, so it is recorded once into the
+ * background cache by DrawOptionsMenu()
+ */
+void UIRenderer::DrawOptionsContent() const {
     // Controls menu background
     ClearBackground(DARKGRAY);
     DrawRectangle(30, 30, SCREEN_WIDTH - 60, SCREEN_HEIGHT - 60, LIGHTGRAY);
@@ -545,13 +600,13 @@ void UIRenderer::DrawOptionsMenu() const {
 
     // Title
     const char* title = "CONTROLS";
-    int titleWidth = MeasureText(title, 40);
-    DrawText(title, SCREEN_WIDTH / 2 - titleWidth / 2, 60, 40, BLACK);
+    int titleWidth = textCache.Measure(title, 40);
+    textCache.Draw(title, SCREEN_WIDTH / 2 - titleWidth / 2, 60, 40, BLACK);
 
     // Subtitle
     const char* subtitle = "Master the art of space flight";
-    int subtitleWidth = MeasureText(subtitle, 16);
-    DrawText(subtitle, SCREEN_WIDTH / 2 - subtitleWidth / 2, 110, 16, DARKGRAY);
+    int subtitleWidth = textCache.Measure(subtitle, 16);
+    textCache.Draw(subtitle, SCREEN_WIDTH / 2 - subtitleWidth / 2, 110, 16, DARKGRAY);
 
     // Control categories
     int startY = 150;
@@ -559,73 +614,73 @@ void UIRenderer::DrawOptionsMenu() const {
     int currentY = startY;
 
     // Movement section
-    DrawText("MOVEMENT:", 60, currentY, 20, MAROON);
+    textCache.Draw("MOVEMENT:", 60, currentY, 20, MAROON);
     currentY += 30;
 
-    DrawText("W / UP ARROW", 80, currentY, 16, BLACK);
-    DrawText("- Thrust forward", 220, currentY, 16, DARKGRAY);
+    textCache.Draw("W / UP ARROW", 80, currentY, 16, BLACK);
+    textCache.Draw("- Thrust forward", 220, currentY, 16, DARKGRAY);
     currentY += lineHeight;
 
-    DrawText("A / LEFT ARROW", 80, currentY, 16, BLACK);
-    DrawText("- Rotate left", 220, currentY, 16, DARKGRAY);
+    textCache.Draw("A / LEFT ARROW", 80, currentY, 16, BLACK);
+    textCache.Draw("- Rotate left", 220, currentY, 16, DARKGRAY);
     currentY += lineHeight;
 
-    DrawText("D / RIGHT ARROW", 80, currentY, 16, BLACK);
-    DrawText("- Rotate right", 220, currentY, 16, DARKGRAY);
+    textCache.Draw("D / RIGHT ARROW", 80, currentY, 16, BLACK);
+    textCache.Draw("- Rotate right", 220, currentY, 16, DARKGRAY);
     currentY += lineHeight + 15;
 
     // Combat section
-    DrawText("COMBAT:", 60, currentY, 20, MAROON);
+    textCache.Draw("COMBAT:", 60, currentY, 20, MAROON);
     currentY += 30;
 
-    DrawText("SPACEBAR", 80, currentY, 16, BLACK);
-    DrawText("- Fire projectiles", 220, currentY, 16, DARKGRAY);
+    textCache.Draw("SPACEBAR", 80, currentY, 16, BLACK);
+    textCache.Draw("- Fire projectiles", 220, currentY, 16, DARKGRAY);
     currentY += lineHeight;
 
-    DrawText("SHIFT", 80, currentY, 16, BLACK);
-    DrawText("- Use collected item", 220, currentY, 16, DARKGRAY);
+    textCache.Draw("SHIFT", 80, currentY, 16, BLACK);
+    textCache.Draw("- Use collected item", 220, currentY, 16, DARKGRAY);
     currentY += lineHeight + 15;
 
     // Items section
-    DrawText("POWER-UPS:", 60, currentY, 20, MAROON);
+    textCache.Draw("POWER-UPS:", 60, currentY, 20, MAROON);
     currentY += 30;
 
-    DrawText("RAPID FIRE (Red)", 80, currentY, 16, RED);
-    DrawText("- Faster shooting for 50 shots", 260, currentY, 16, DARKGRAY);
+    textCache.Draw("RAPID FIRE (Red)", 80, currentY, 16, RED);
+    textCache.Draw("- Faster shooting for 50 shots", 260, currentY, 16, DARKGRAY);
     currentY += lineHeight;
 
-    DrawText("SHIELD (Blue)", 80, currentY, 16, BLUE);
-    DrawText("- Absorbs one asteroid hit", 260, currentY, 16, DARKGRAY);
+    textCache.Draw("SHIELD (Blue)", 80, currentY, 16, BLUE);
+    textCache.Draw("- Absorbs one asteroid hit", 260, currentY, 16, DARKGRAY);
     currentY += lineHeight;
 
-    DrawText("EXTRA LIFE (Green)", 80, currentY, 16, GREEN);
-    DrawText("- Instantly adds one life", 260, currentY, 16, DARKGRAY);
+    textCache.Draw("EXTRA LIFE (Green)", 80, currentY, 16, GREEN);
+    textCache.Draw("- Instantly adds one life", 260, currentY, 16, DARKGRAY);
     currentY += lineHeight + 15;
 
     // Navigation section
-    DrawText("NAVIGATION:", 60, currentY, 20, MAROON);
+    textCache.Draw("NAVIGATION:", 60, currentY, 20, MAROON);
     currentY += 30;
 
-    DrawText("TAB", 80, currentY, 16, BLACK);
-    DrawText("- Return to main menu / Quit game", 220, currentY, 16, DARKGRAY);
+    textCache.Draw("TAB", 80, currentY, 16, BLACK);
+    textCache.Draw("- Return to main menu / Quit game", 220, currentY, 16, DARKGRAY);
     currentY += lineHeight;
 
     // Tips section
-    DrawText("TIPS:", 60, currentY, 20, MAROON);
+    textCache.Draw("TIPS:", 60, currentY, 20, MAROON);
     currentY += 25;
 
-    DrawText("• Destroy large asteroids to create smaller ones", 80, currentY, 14, DARKBLUE);
+    textCache.Draw("• Destroy large asteroids to create smaller ones", 80, currentY, 14, DARKBLUE);
     currentY += 20;
-    DrawText("• Collect power-ups by flying over them", 80, currentY, 14, DARKBLUE);
+    textCache.Draw("• Collect power-ups by flying over them", 80, currentY, 14, DARKBLUE);
     currentY += 20;
-    DrawText("• You are invulnerable for 3 seconds after respawning", 80, currentY, 14, DARKBLUE);
+    textCache.Draw("• You are invulnerable for 3 seconds after respawning", 80, currentY, 14, DARKBLUE);
     currentY += 20;
-    DrawText("• Power-ups spawn every 15 seconds or from large asteroids", 80, currentY, 14, DARKBLUE);
+    textCache.Draw("• Power-ups spawn every 15 seconds or from large asteroids", 80, currentY, 14, DARKBLUE);
 
     // Return instruction
     const char* backText = "Press ENTER or ESC to return to main menu";
-    int backWidth = MeasureText(backText, 18);
-    DrawText(backText, SCREEN_WIDTH / 2 - backWidth / 2, SCREEN_HEIGHT - 80, 18, BLACK);
+    int backWidth = textCache.Measure(backText, 18);
+    textCache.Draw(backText, SCREEN_WIDTH / 2 - backWidth / 2, SCREEN_HEIGHT - 80, 18, BLACK);
 
     // Decorative elements
     DrawRectangleLines(50, 140, SCREEN_WIDTH - 100, 2, BLACK);
@@ -644,23 +699,23 @@ void UIRenderer::DrawNameEntryScreen() const {
 
     // Main title
     const char* title = "NEW HIGH SCORE!";
-    int titleWidth = MeasureText(title, 50);
-    DrawText(title, SCREEN_WIDTH / 2 - titleWidth / 2, 100, 50, GOLD);
+    int titleWidth = textCache.Measure(title, 50);
+    textCache.Draw(title, SCREEN_WIDTH / 2 - titleWidth / 2, 100, 50, GOLD);
 
     // Congratulations text
     const char* congratsText = "Congratulations! You achieved a new high score!";
-    int congratsWidth = MeasureText(congratsText, 20);
-    DrawText(congratsText, SCREEN_WIDTH / 2 - congratsWidth / 2, 170, 20, WHITE);
+    int congratsWidth = textCache.Measure(congratsText, 20);
+    textCache.Draw(congratsText, SCREEN_WIDTH / 2 - congratsWidth / 2, 170, 20, WHITE);
 
     // Display score
-    const char* scoreText = TextFormat("Your Score: %d", stateManager.GetNameEntryScore());
-    int scoreWidth = MeasureText(scoreText, 30);
-    DrawText(scoreText, SCREEN_WIDTH / 2 - scoreWidth / 2, 220, 30, YELLOW);
+    const char* scoreText = frameArena->Format("Your Score: %d", frame->stateManager.GetNameEntryScore());
+    int scoreWidth = textCache.Measure(scoreText, 30);
+    textCache.Draw(scoreText, SCREEN_WIDTH / 2 - scoreWidth / 2, 220, 30, YELLOW);
 
     // Position in rankings
-    const char* posText = TextFormat("Rank: #%d", stateManager.GetNameEntryPosition() + 1);
-    int posWidth = MeasureText(posText, 25);
-    DrawText(posText, SCREEN_WIDTH / 2 - posWidth / 2, 260, 25, LIME);
+    const char* posText = frameArena->Format("Rank: #%d", frame->stateManager.GetNameEntryPosition() + 1);
+    int posWidth = textCache.Measure(posText, 25);
+    textCache.Draw(posText, SCREEN_WIDTH / 2 - posWidth / 2, 260, 25, LIME);
 
     // Name entry area
     DrawRectangle(SCREEN_WIDTH / 2 - 200, 320, 400, 80, Color{ 40, 40, 60, 200 });
@@ -668,11 +723,11 @@ void UIRenderer::DrawNameEntryScreen() const {
 
     // Name entry title
     const char* nameTitle = "Enter your name (max 5 characters):";
-    int nameTitleWidth = MeasureText(nameTitle, 18);
-    DrawText(nameTitle, SCREEN_WIDTH / 2 - nameTitleWidth / 2, 300, 18, LIGHTGRAY);
+    int nameTitleWidth = textCache.Measure(nameTitle, 18);
+    textCache.Draw(nameTitle, SCREEN_WIDTH / 2 - nameTitleWidth / 2, 300, 18, LIGHTGRAY);
 
     // Current name with cursor
-    std::string currentName = stateManager.GetPlayerName();
+    std::string currentName = frame->stateManager.GetPlayerName();
 
     // Fill name with underscores for better visualization
     std::string displayName = currentName;
@@ -699,13 +754,13 @@ void UIRenderer::DrawNameEntryScreen() const {
         // Letter - centered in field
         char charStr[2] = { displayName[i], '\0' };
         Color textColor = (i < (int)currentName.length()) ? WHITE : GRAY;
-        int singleCharWidth = MeasureText(charStr, nameSize);
+        int singleCharWidth = textCache.Measure(charStr, nameSize);
         int centeredX = charX + (charWidth - singleCharWidth) / 2;
-        DrawText(charStr, centeredX, nameY, nameSize, textColor);
+        textCache.Draw(charStr, centeredX, nameY, nameSize, textColor);
     }
 
     // Blinking cursor - adjusted to fixed positions
-    if ((int)(stateManager.GetCursorBlinkTimer() * 2.0f) % 2 == 0 && currentName.length() < 5) {
+    if ((int)(frame->stateManager.GetCursorBlinkTimer() * 2.0f) % 2 == 0 && currentName.length() < 5) {
         int cursorX = nameX + (int)currentName.length() * charWidth + charWidth / 2;
         DrawLine(cursorX, nameY, cursorX, nameY + nameSize, YELLOW);
     }
@@ -720,14 +775,14 @@ void UIRenderer::DrawNameEntryScreen() const {
     };
 
     for (int i = 0; i < 5; i++) {
-        int instrWidth = MeasureText(instructions[i], 16);
-        DrawText(instructions[i], SCREEN_WIDTH / 2 - instrWidth / 2, 450 + i * 25, 16, LIGHTGRAY);
+        int instrWidth = textCache.Measure(instructions[i], 16);
+        textCache.Draw(instructions[i], SCREEN_WIDTH / 2 - instrWidth / 2, 450 + i * 25, 16, LIGHTGRAY);
     }
 
     // Show progress
-    const char* progressText = TextFormat("Characters entered: %d/5", (int)currentName.length());
-    int progressWidth = MeasureText(progressText, 14);
-    DrawText(progressText, SCREEN_WIDTH / 2 - progressWidth / 2, 580, 14, GRAY);
+    const char* progressText = frameArena->Format("Characters entered: %d/5", (int)currentName.length());
+    int progressWidth = textCache.Measure(progressText, 14);
+    textCache.Draw(progressText, SCREEN_WIDTH / 2 - progressWidth / 2, 580, 14, GRAY);
 
     // Animated particles for celebration effect
     static float particleTimer = 0;
@@ -757,92 +812,90 @@ void UIRenderer::DrawHighscoreScreen() const {
 
     // Title
     const char* title = "HIGH SCORES";
-    int titleWidth = MeasureText(title, 50);
-    DrawText(title, SCREEN_WIDTH / 2 - titleWidth / 2, 50, 50, GOLD);
+    int titleWidth = textCache.Measure(title, 50);
+    textCache.Draw(title, SCREEN_WIDTH / 2 - titleWidth / 2, 50, 50, GOLD);
 
     // Subtitle
     const char* subtitle = "Hall of Fame - Top Pilots";
-    int subtitleWidth = MeasureText(subtitle, 20);
-    DrawText(subtitle, SCREEN_WIDTH / 2 - subtitleWidth / 2, 110, 20, LIGHTGRAY);
+    int subtitleWidth = textCache.Measure(subtitle, 20);
+    textCache.Draw(subtitle, SCREEN_WIDTH / 2 - subtitleWidth / 2, 110, 20, LIGHTGRAY);
 
     // High score list
-    if (highscoreManager) {
-        const auto& highscores = highscoreManager->GetHighscores();
-
-        // Table header
-        int tableStartY = 160;
-        int lineHeight = 40;
-
-        // Header background
-        DrawRectangle(SCREEN_WIDTH / 2 - 400, tableStartY - 10, 800, 35, Color{ 40, 40, 60, 150 });
-        DrawRectangleLines(SCREEN_WIDTH / 2 - 400, tableStartY - 10, 800, 35, WHITE);
-
-        // Header text
-        DrawText("RANK", SCREEN_WIDTH / 2 - 350, tableStartY, 20, WHITE);
-        DrawText("NAME", SCREEN_WIDTH / 2 - 200, tableStartY, 20, WHITE);
-        DrawText("SCORE", SCREEN_WIDTH / 2 + 200, tableStartY, 20, WHITE);
+    const auto& highscores = frame->highscores;
+
+    // Table header
+    int tableStartY = 160;
+    int lineHeight = 40;
+
+    // Header background
+    DrawRectangle(SCREEN_WIDTH / 2 - 400, tableStartY - 10, 800, 35, Color{ 40, 40, 60, 150 });
+    DrawRectangleLines(SCREEN_WIDTH / 2 - 400, tableStartY - 10, 800, 35, WHITE);
+
+    // Header text
+    textCache.Draw("RANK", SCREEN_WIDTH / 2 - 350, tableStartY, 20, WHITE);
+    textCache.Draw("NAME", SCREEN_WIDTH / 2 - 200, tableStartY, 20, WHITE);
+    textCache.Draw("SCORE", SCREEN_WIDTH / 2 + 200, tableStartY, 20, WHITE);
+
+    // High score entries
+    for (size_t i = 0; i < highscores.size() && i < 10; i++) {
+        int entryY = tableStartY + 40 + (int)i * lineHeight;
+
+        // Alternating background colors
+        Color bgColor = (i % 2 == 0) ? Color{ 25, 25, 45, 100 } : Color{ 35, 35, 55, 100 };
+        DrawRectangle(SCREEN_WIDTH / 2 - 400, entryY - 5, 800, lineHeight - 5, bgColor);
+
+        // Special highlighting for top 3
+        Color textColor = WHITE;
+        Color rankColor = WHITE;
+        if (i == 0) { rankColor = GOLD; textColor = GOLD; }
+        else if (i == 1) { rankColor = Color{ 192, 192, 192, 255 }; textColor = Color{ 192, 192, 192, 255 }; } // Silver
+        else if (i == 2) { rankColor = Color{ 205, 127, 50, 255 }; textColor = Color{ 205, 127, 50, 255 }; } // Bronze
+
+        // Rank
+        const char* rankText = frameArena->Format("#%d", (int)i + 1);
+        textCache.Draw(rankText, SCREEN_WIDTH / 2 - 350, entryY, 24, rankColor);
+
+        // Name
+        textCache.Draw(highscores[i].name.c_str(), SCREEN_WIDTH / 2 - 200, entryY, 24, textColor);
+
+        // Score with formatting
+        const char* scoreText = frameArena->Format("%d", highscores[i].score);
+        int scoreWidth = textCache.Measure(scoreText, 24);
+        textCache.Draw(scoreText, SCREEN_WIDTH / 2 + 350 - scoreWidth, entryY, 24, textColor);
+
+        // Decorative line after top 3
+        if (i == 2) {
+            DrawLine(SCREEN_WIDTH / 2 - 380, entryY + 35, SCREEN_WIDTH / 2 + 380, entryY + 35, GRAY);
+        }
+    }
 
-        // High score entries
-        for (size_t i = 0; i < highscores.size() && i < 10; i++) {
+    // If fewer than 10 entries are available
+    if (highscores.size() < 10) {
+        for (size_t i = highscores.size(); i < 10; i++) {
             int entryY = tableStartY + 40 + (int)i * lineHeight;
 
-            // Alternating background colors
-            Color bgColor = (i % 2 == 0) ? Color{ 25, 25, 45, 100 } : Color{ 35, 35, 55, 100 };
+            Color bgColor = (i % 2 == 0) ? Color{ 25, 25, 45, 50 } : Color{ 35, 35, 55, 50 };
             DrawRectangle(SCREEN_WIDTH / 2 - 400, entryY - 5, 800, lineHeight - 5, bgColor);
 
-            // Special highlighting for top 3
-            Color textColor = WHITE;
-            Color rankColor = WHITE;
-            if (i == 0) { rankColor = GOLD; textColor = GOLD; }
-            else if (i == 1) { rankColor = Color{ 192, 192, 192, 255 }; textColor = Color{ 192, 192, 192, 255 }; } // Silver
-            else if (i == 2) { rankColor = Color{ 205, 127, 50, 255 }; textColor = Color{ 205, 127, 50, 255 }; } // Bronze
-
-            // Rank
-            const char* rankText = TextFormat("#%d", (int)i + 1);
-            DrawText(rankText, SCREEN_WIDTH / 2 - 350, entryY, 24, rankColor);
-
-            // Name
-            DrawText(highscores[i].name.c_str(), SCREEN_WIDTH / 2 - 200, entryY, 24, textColor);
-
-            // Score with formatting
-            const char* scoreText = TextFormat("%d", highscores[i].score);
-            int scoreWidth = MeasureText(scoreText, 24);
-            DrawText(scoreText, SCREEN_WIDTH / 2 + 350 - scoreWidth, entryY, 24, textColor);
-
-            // Decorative line after top 3
-            if (i == 2) {
-                DrawLine(SCREEN_WIDTH / 2 - 380, entryY + 35, SCREEN_WIDTH / 2 + 380, entryY + 35, GRAY);
-            }
-        }
-
-        // If fewer than 10 entries are available
-        if (highscores.size() < 10) {
-            for (size_t i = highscores.size(); i < 10; i++) {
-                int entryY = tableStartY + 40 + (int)i * lineHeight;
-
-                Color bgColor = (i % 2 == 0) ? Color{ 25, 25, 45, 50 } : Color{ 35, 35, 55, 50 };
-                DrawRectangle(SCREEN_WIDTH / 2 - 400, entryY - 5, 800, lineHeight - 5, bgColor);
-
-                const char* rankText = TextFormat("#%d", (int)i + 1);
-                DrawText(rankText, SCREEN_WIDTH / 2 - 350, entryY, 24, GRAY);
-                DrawText("-----", SCREEN_WIDTH / 2 - 200, entryY, 24, GRAY);
-                DrawText("---", SCREEN_WIDTH / 2 + 300, entryY, 24, GRAY);
-            }
+            const char* rankText = frameArena->Format("#%d", (int)i + 1);
+            textCache.Draw(rankText, SCREEN_WIDTH / 2 - 350, entryY, 24, GRAY);
+            textCache.Draw("-----", SCREEN_WIDTH / 2 - 200, entryY, 24, GRAY);
+            textCache.Draw("---", SCREEN_WIDTH / 2 + 300, entryY, 24, GRAY);
         }
-
-        // Border around entire table
-        DrawRectangleLines(SCREEN_WIDTH / 2 - 400, tableStartY - 10, 800, 450, WHITE);
     }
 
+    // Border around entire table
+    DrawRectangleLines(SCREEN_WIDTH / 2 - 400, tableStartY - 10, 800, 450, WHITE);
+
     // Instructions
     const char* instruction = "Press ENTER or ESC to return to main menu";
-    int instrWidth = MeasureText(instruction, 20);
-    DrawText(instruction, SCREEN_WIDTH / 2 - instrWidth / 2, SCREEN_HEIGHT - 80, 20, WHITE);
+    int instrWidth = textCache.Measure(instruction, 20);
+    textCache.Draw(instruction, SCREEN_WIDTH / 2 - instrWidth / 2, SCREEN_HEIGHT - 80, 20, WHITE);
 
     // Additional info
     const char* info = "Destroy asteroids and collect power-ups to climb the rankings!";
-    int infoWidth = MeasureText(info, 16);
-    DrawText(info, SCREEN_WIDTH / 2 - infoWidth / 2, SCREEN_HEIGHT - 50, 16, LIGHTGRAY);
+    int infoWidth = textCache.Measure(info, 16);
+    textCache.Draw(info, SCREEN_WIDTH / 2 - infoWidth / 2, SCREEN_HEIGHT - 50, 16, LIGHTGRAY);
 
     // Animated stars in background
     static float starTimer = 0;
@@ -864,6 +917,21 @@ void UIRenderer::DrawHighscoreScreen() const {
     }
 }
 
+/**
+ * Draws the static parts of the credits screen on a transparent layer
+ * Recorded once into the background cache by DrawCreditsScreen()
+ * @param container Area of the scrolling credits container
+ */
+void UIRenderer::DrawCreditsChrome(Rectangle container) const {
+    // Subtitle
+    const char* subtitle = "The People Behind This Epic Space Adventure";
+    int subtitleWidth = textCache.Measure(subtitle, 20);
+    textCache.Draw(subtitle, SCREEN_WIDTH / 2 - subtitleWidth / 2, 120, 20, LIGHTGRAY);
+
+    // Container frame
+    DrawRectangleLines((int)container.x, (int)container.y, (int)container.width, (int)container.height, GOLD);
+}
+
 /**
  * Renders the credits screen with scrolling animation
  * Features animated background, scrolling credits list, and special thanks
@@ -894,21 +962,16 @@ void UIRenderer::DrawCreditsScreen() const {
 
     // Main title with glow effect
     const char* title = "CREDITS";
-    int titleWidth = MeasureText(title, 60);
+    int titleWidth = textCache.Measure(title, 60);
     float titleGlow = 1.0f + 0.3f * sin(animTime * 3.0f);
 
     // Title glow (multiple layers)
     for (int i = 0; i < 3; i++) {
         Color glowColor = GOLD;
         glowColor.a = (unsigned char)(30 - i * 10);
-        DrawText(title, SCREEN_WIDTH / 2 - titleWidth / 2 - i, 50 - i, (int)(60 * titleGlow), glowColor);
+        textCache.Draw(title, SCREEN_WIDTH / 2 - titleWidth / 2 - i, 50 - i, (int)(60 * titleGlow), glowColor);
     }
-    DrawText(title, SCREEN_WIDTH / 2 - titleWidth / 2, 50, (int)(60 * titleGlow), GOLD);
-
-    // Subtitle
-    const char* subtitle = "The People Behind This Epic Space Adventure";
-    int subtitleWidth = MeasureText(subtitle, 20);
-    DrawText(subtitle, SCREEN_WIDTH / 2 - subtitleWidth / 2, 120, 20, LIGHTGRAY);
+    textCache.Draw(title, SCREEN_WIDTH / 2 - titleWidth / 2, 50, (int)(60 * titleGlow), GOLD);
 
     // Credits container (larger, scrollable area)
     int containerX = SCREEN_WIDTH / 2 - 500;
@@ -916,7 +979,13 @@ void UIRenderer::DrawCreditsScreen() const {
     int containerWidth = 1000;
     int containerHeight = 450;
     DrawRectangle(containerX, containerY, containerWidth, containerHeight, Color{ 20, 20, 40, 200 });
-    DrawRectangleLines(containerX, containerY, containerWidth, containerHeight, GOLD);
+
+    // Subtitle and container frame from the background cache
+    if (backgroundCache.BeginRecording(CREDITS_CHROME_LAYER)) {
+        DrawCreditsChrome({ (float)containerX, (float)containerY, (float)containerWidth, (float)containerHeight });
+        backgroundCache.EndRecording();
+    }
+    backgroundCache.Draw(CREDITS_CHROME_LAYER);
 
     // Scrolling credits - vertically scrolling
     float scrollSpeed = 30.0f; // Pixels per second
@@ -962,20 +1031,20 @@ void UIRenderer::DrawCreditsScreen() const {
     for (int i = 0; i < numCredits; i++) {
         if (currentY >= containerY && currentY <= containerY + containerHeight - lineHeight) {
             // Role (left, but within container)
-            DrawText(credits[i].role, containerX + 50, currentY, 16, credits[i].roleColor);
+            textCache.Draw(credits[i].role, containerX + 50, currentY, 16, credits[i].roleColor);
 
             // Separator dots (shorter)
-            DrawText("........................", SCREEN_WIDTH / 2 - 80, currentY, 16, GRAY);
+            textCache.Draw("........................", SCREEN_WIDTH / 2 - 80, currentY, 16, GRAY);
 
             // Name (right, but within container)
-            int nameWidth = MeasureText(credits[i].name, 16);
-            DrawText(credits[i].name, containerX + containerWidth - nameWidth - 50, currentY, 16, credits[i].nameColor);
+            int nameWidth = textCache.Measure(credits[i].name, 16);
+            textCache.Draw(credits[i].name, containerX + containerWidth - nameWidth - 50, currentY, 16, credits[i].nameColor);
 
             // Shimmer effect for Adrian's name
             if (strcmp(credits[i].name, "Adrian Kranyak") == 0 && (int)(animTime * 4.0f + i) % 8 == 0) {
                 Color shimmer = YELLOW;
                 shimmer.a = 100;
-                DrawText(credits[i].name, containerX + containerWidth - nameWidth - 49, currentY + 1, 16, shimmer);
+                textCache.Draw(credits[i].name, containerX + containerWidth - nameWidth - 49, currentY + 1, 16, shimmer);
             }
         }
         currentY += lineHeight;
@@ -987,8 +1056,8 @@ void UIRenderer::DrawCreditsScreen() const {
     // Special thanks title
     if (currentY >= containerY && currentY <= containerY + containerHeight - lineHeight) {
         const char* thanksTitle = "SPECIAL THANKS";
-        int thanksTitleWidth = MeasureText(thanksTitle, 20);
-        DrawText(thanksTitle, SCREEN_WIDTH / 2 - thanksTitleWidth / 2, currentY, 20, GOLD);
+        int thanksTitleWidth = textCache.Measure(thanksTitle, 20);
+        textCache.Draw(thanksTitle, SCREEN_WIDTH / 2 - thanksTitleWidth / 2, currentY, 20, GOLD);
     }
     currentY += 30;
 
@@ -1007,24 +1076,24 @@ void UIRenderer::DrawCreditsScreen() const {
     int numThanks = sizeof(specialThanks) / sizeof(specialThanks[0]);
     for (int i = 0; i < numThanks; i++) {
         if (currentY >= containerY && currentY <= containerY + containerHeight - lineHeight) {
-            int thanksWidth = MeasureText(specialThanks[i], 14);
-            DrawText(specialThanks[i], SCREEN_WIDTH / 2 - thanksWidth / 2, currentY, 14, LIGHTGRAY);
+            int thanksWidth = textCache.Measure(specialThanks[i], 14);
+            textCache.Draw(specialThanks[i], SCREEN_WIDTH / 2 - thanksWidth / 2, currentY, 14, LIGHTGRAY);
         }
         currentY += 25;
     }
 
     // Footer (outside container, fixed at screen edge)
     const char* copyright = "© 2025 Adrian Kranyak - All Rights Reserved";
-    int copyrightWidth = MeasureText(copyright, 12);
-    DrawText(copyright, SCREEN_WIDTH / 2 - copyrightWidth / 2, SCREEN_HEIGHT - 100, 12, GRAY);
+    int copyrightWidth = textCache.Measure(copyright, 12);
+    textCache.Draw(copyright, SCREEN_WIDTH / 2 - copyrightWidth / 2, SCREEN_HEIGHT - 100, 12, GRAY);
 
     const char* version = "Asteroids Enhanced Edition v2.0 - MS Paint Style";
-    int versionWidth = MeasureText(version, 14);
-    DrawText(version, SCREEN_WIDTH / 2 - versionWidth / 2, SCREEN_HEIGHT - 80, 14, Color{ 150, 150, 150, 255 });
+    int versionWidth = textCache.Measure(version, 14);
+    textCache.Draw(version, SCREEN_WIDTH / 2 - versionWidth / 2, SCREEN_HEIGHT - 80, 14, Color{ 150, 150, 150, 255 });
 
     const char* engine = "Powered by Raylib & C++";
-    int engineWidth = MeasureText(engine, 12);
-    DrawText(engine, SCREEN_WIDTH / 2 - engineWidth / 2, SCREEN_HEIGHT - 60, 12, Color{ 100, 150, 200, 255 });
+    int engineWidth = textCache.Measure(engine, 12);
+    textCache.Draw(engine, SCREEN_WIDTH / 2 - engineWidth / 2, SCREEN_HEIGHT - 60, 12, Color{ 100, 150, 200, 255 });
 
     // Animated spaceships (outside container)
     for (int i = 0; i < 3; i++) {
@@ -1052,7 +1121,7 @@ void UIRenderer::DrawCreditsScreen() const {
 
         // Thrust particles
         for (int j = 0; j < 2; j++) {
-            int particleX = shipX + GetRandomValue(-1, 1);
+            int particleX = shipX + effects.Range(-1, 1);
             int particleY = shipY + 6 + j * 2;
             Color particleColor = Color{ 255, (unsigned char)(150 + j * 50), 0, (unsigned char)(150 - j * 50) };
             DrawCircle(particleX, particleY, 1, particleColor);
@@ -1061,10 +1130,57 @@ void UIRenderer::DrawCreditsScreen() const {
 
     // Instructions for returning
     const char* instruction = "Press any key to return to main menu";
-    int instrWidth = MeasureText(instruction, 18);
+    int instrWidth = textCache.Measure(instruction, 18);
 
     // Blinking text
     if ((int)(animTime * 3.0f) % 2 == 0) {
-        DrawText(instruction, SCREEN_WIDTH / 2 - instrWidth / 2, SCREEN_HEIGHT - 30, 18, WHITE);
+        textCache.Draw(instruction, SCREEN_WIDTH / 2 - instrWidth / 2, SCREEN_HEIGHT - 30, 18, WHITE);
     }
-}
\ No newline at end of file
+}
+/**
+ * Renders the profiler overlay (toggled with F3) on top of any screen
+ * Lists last, average, p99 and maximum milliseconds of every zone over the
+ * profiler's ring buffer, followed by the object pool usage
+ * Values change every frame, so they bypass the text cache
+ */
+void UIRenderer::DrawProfilerOverlay() const {
+    int panelWidth = 380;
+    int panelHeight = 64 + PROFILE_ZONE_COUNT * 16 + 3 * 16;
+    int panelX = 5;
+    int panelY = SCREEN_HEIGHT - panelHeight - 5;
+    DrawRectangle(panelX, panelY, panelWidth, panelHeight, Color{ 0, 0, 0, 190 });
+    DrawRectangleLines(panelX, panelY, panelWidth, panelHeight, GREEN);
+
+    int textX = panelX + 10;
+    int y = panelY + 8;
+#if ENABLE_ALLOCATION_COUNTER
+    DrawText(frameArena->Format("PROFILER  %d frames  heap allocs: tick %llu, draw %llu", Profiler::GetFrameCount(),
+        (unsigned long long)frame->tickAllocations, (unsigned long long)drawAllocations), textX, y, 12, GREEN);
+#else
+    DrawText(frameArena->Format("PROFILER  %d frames", Profiler::GetFrameCount()), textX, y, 12, GREEN);
+#endif
+    y += 20;
+    DrawText("zone            last     avg     p99     max", textX, y, 10, LIGHTGRAY);
+    y += 16;
+
+    for (int zone = 0; zone < PROFILE_ZONE_COUNT; zone++) {
+        ZoneStats stats = Profiler::GetStats((ProfileZone)zone);
+        DrawText(Profiler::GetZoneName((ProfileZone)zone), textX, y, 10, WHITE);
+        DrawText(frameArena->Format("%7.2f %7.2f %7.2f %7.2f", stats.last, stats.average, stats.p99, stats.max),
+            textX + 110, y, 10, WHITE);
+        y += 16;
+    }
+
+    y += 8;
+    const PoolStats* pools[] = {
+        &frame->asteroidStats,
+        &frame->projectileStats,
+        &frame->powerupStats
+    };
+    const char* poolNames[] = { "Asteroids", "Projectiles", "PowerUps" };
+    for (int i = 0; i < 3; i++) {
+        DrawText(frameArena->Format("%-12s live %4d  dead %4d  peak %4d  cap %4d", poolNames[i],
+            pools[i]->live, pools[i]->dead, pools[i]->peak, pools[i]->capacity), textX, y, 10, YELLOW);
+        y += 16;
+    }
+}
@@ -1,44 +1,83 @@
 #ifndef UIRENDERER_H
 #define UIRENDERER_H
 
-#include "gamestate.h"
-#include "score.h"
-#include "spaceship.h"
-#include "objectmanager.h"
+#include "renderSnapshot.h"
+#include "asteroidRenderer.h"
+#include "backgroundCache.h"
+#include "textCache.h"
+#include "random.h"
+#include "frameArena.h"
+#include <cstdint>
+
+/**
+ * Numeric HUD value whose text is re-formatted only when the value changes
+ */
+struct HudField {
+    int value = 0;          // Value the layout was formatted from
+    TextLayout layout;      // Formatted and laid-out text
+
+    /**
+     * Stores a new value
+     * @param newValue Current value
+     * @return True if the text must be re-formatted
+     */
+    bool Update(int newValue) {
+        if (value == newValue && layout.IsFontReady()) return false;
+        value = newValue;
+        return true;
+    }
+};
 
 class UIRenderer {
 private:
-    GameStateManager& stateManager;     // Reference to game state manager for state-based rendering
-    Score& gameScore;                   // Reference to score system for displaying points and levels
-    Spaceship& player;                  // Reference to player spaceship for status information
-    ObjectManager& objectManager;       // Reference to object manager for rendering game objects
-    int& currentItem;                   // Reference to currently held power-up item
-    class HighscoreManager* highscoreManager = nullptr; // Pointer to high score manager (optional)
+    mutable const RenderSnapshot* frame; // Snapshot being drawn (valid during DrawCurrentState only)
+    float interpolationAlpha = 1.0f;    // Blend factor between the last two simulation steps
+    mutable AsteroidRenderer asteroidRenderer; // Batches all asteroids into one draw submission
+    mutable BackgroundCache backgroundCache;   // Render textures of static screen layers
+    mutable TextCache textCache;               // Measured widths and glyph quads of UI labels
+    mutable HudField scoreField;               // HUD "SCORE" text
+    mutable HudField livesField;               // HUD "LIVES" text
+    mutable HudField levelField;               // HUD "LEVEL" text
+    mutable HudField highScoreField;           // HUD "HIGH" text
+    mutable HudField shieldField;              // HUD shield timer text, in tenths of a second
+    FrameArena* frameArena;                    // Formatted text of the current frame (reset by Game::Draw)
+    uint64_t drawAllocations;                  // Heap allocations of the previous frame, for the profiler overlay
+    mutable RandomGenerator effects;           // Cosmetic jitter and particles, separate from every simulation stream
 
 public:
-    UIRenderer(GameStateManager& stateMgr /* Reference to state manager */,
-        Score& score /* Reference to score system */,
-        Spaceship& ship /* Reference to player spaceship */,
-        ObjectManager& objMgr /* Reference to object manager */,
-        int& currentItemRef /* Reference to current power-up item */);
-
-    void DrawCurrentState() const;
-    void SetHighscoreManager(class HighscoreManager* hsMgr) {
-        highscoreManager = hsMgr;
+    UIRenderer();
+
+    void DrawCurrentState(const RenderSnapshot& snapshot /* Simulation state to draw */) const;
+    void SetInterpolationAlpha(float alpha /* 0 = previous step, 1 = current step */) {
+        interpolationAlpha = alpha;
+    }
+    void SetFrameArena(FrameArena* arena /* Arena reset after every frame */) {
+        frameArena = arena;
+    }
+    void SetDrawAllocations(uint64_t allocations /* Heap allocations of the last frame */) {
+        drawAllocations = allocations;
     }
 
 private:
     void DrawCheckeredBackground() const;
+    void DrawCheckeredGrid() const;
     void DrawMainMenu() const;
     void DrawInGame() const;
     void DrawGameOver() const;
     void DrawGameObjects() const;
     void DrawGameUI() const;
     void DrawOptionsMenu() const;
+    void DrawOptionsContent() const;
     void DrawItemSlot() const;
+    void UpdateHudField(HudField& field /* Field to update */,
+        int value /* Current value */,
+        const char* format /* printf-style format with a single %d */,
+        int fontSize /* Font size in pixels */) const;
     void DrawNameEntryScreen() const;
     void DrawHighscoreScreen() const;
     void DrawCreditsScreen() const;  // Credits method added
+    void DrawCreditsChrome(Rectangle container /* Credits container area */) const;
+    void DrawProfilerOverlay() const;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,64 @@
+#include "worldChecksum.h"
+
+/**
+ * Mixes raw bytes into an FNV-1a hash
+ * @param hash Running hash value
+ * @param data Bytes to mix in
+ * @param size Number of bytes
+ */
+void HashBytes(uint32_t& hash, const void* data, size_t size) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+}
+
+/**
+ * Computes a checksum of a simulated world
+ * Shared by single-player games and multiplayer sessions, so both hash the
+ * same state the same way. Covers score, every ship and the exact bits of
+ * every live object's position and velocity, so any divergence between two
+ * runs changes the result
+ * @param score Score and level of the world
+ * @param ships Ships of the world
+ * @param shipCount Number of ships
+ * @param objects Asteroids, projectiles and power-ups
+ * @return FNV-1a hash of the world
+ */
+uint32_t ComputeWorldChecksum(const Score& score, const Spaceship* ships, int shipCount, const ObjectManager& objects) {
+    uint32_t hash = 2166136261u;
+
+    int values[] = { score.GetScore(), score.GetLevel() };
+    HashBytes(hash, values, sizeof(values));
+
+    for (int i = 0; i < shipCount; i++) {
+        Vector2 shipState[] = { ships[i].GetPosition(), ships[i].GetVelocity() };
+        float rotation = ships[i].GetRotation();
+        int lives = ships[i].GetLives();
+        HashBytes(hash, shipState, sizeof(shipState));
+        HashBytes(hash, &rotation, sizeof(rotation));
+        HashBytes(hash, &lives, sizeof(lives));
+    }
+
+    const AsteroidStore& asteroids = objects.GetAsteroids();
+    for (int i = 0; i < asteroids.size(); i++) {
+        if (!asteroids.IsAlive(i)) continue;
+        float state[] = { asteroids.px[i], asteroids.py[i], asteroids.vx[i], asteroids.vy[i], asteroids.radius[i] };
+        HashBytes(hash, state, sizeof(state));
+    }
+
+    const ProjectileStore& projectiles = objects.GetProjectiles();
+    for (int i = 0; i < projectiles.size(); i++) {
+        if (!projectiles.IsAlive(i)) continue;
+        float state[] = { projectiles.px[i], projectiles.py[i], projectiles.vx[i], projectiles.vy[i] };
+        HashBytes(hash, state, sizeof(state));
+    }
+
+    for (const PowerUp& powerup : objects.GetPowerUps()) {
+        Vector2 position = powerup.GetPosition();
+        int type = (int)powerup.GetType();
+        HashBytes(hash, &position, sizeof(position));
+        HashBytes(hash, &type, sizeof(type));
+    }
+    return hash;
+}
@@ -0,0 +1,18 @@
+#ifndef WORLDCHECKSUM_H
+#define WORLDCHECKSUM_H
+
+#include "objectmanager.h"
+#include "score.h"
+#include "spaceship.h"
+#include <cstddef>
+#include <cstdint>
+
+void HashBytes(uint32_t& hash /* Running FNV-1a hash */,
+    const void* data /* Bytes to mix in */,
+    size_t size /* Number of bytes */);
+uint32_t ComputeWorldChecksum(const Score& score /* Score and level of the world */,
+    const Spaceship* ships /* Ships of the world */,
+    int shipCount /* Number of ships */,
+    const ObjectManager& objects /* Asteroids, projectiles and power-ups */);
+
+#endif
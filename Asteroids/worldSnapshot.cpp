@@ -0,0 +1,194 @@
+#include "worldSnapshot.h"
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <type_traits>
+
+static_assert(std::is_trivially_copyable<WorldState>::value, "WorldState is copied as raw bytes");
+static_assert(std::is_trivially_copyable<PowerUp>::value, "PowerUp is copied as raw bytes");
+static_assert(std::is_trivially_copyable<ObjectCommand>::value, "ObjectCommand is copied as raw bytes");
+
+static const int ASTEROID_FLOAT_ARRAYS = 10;    // Hot arrays plus rotation and rotationSpeed
+static const int PROJECTILE_FLOAT_ARRAYS = 8;   // Hot arrays only
+
+/**
+ * Computes the snapshot size for a set of array counts
+ * @param header Header holding the counts
+ * @return Total size in bytes, header included
+ */
+static size_t SnapshotSize(const WorldSnapshotHeader& header) {
+    return sizeof(WorldSnapshotHeader) + sizeof(WorldState)
+        + header.asteroidCount * (ASTEROID_FLOAT_ARRAYS * sizeof(float) + sizeof(AsteroidSize) + sizeof(int))
+        + header.projectileCount * PROJECTILE_FLOAT_ARRAYS * sizeof(float)
+        + header.powerupCount * sizeof(PowerUp)
+        + header.commandCount * sizeof(ObjectCommand);
+}
+
+/**
+ * Copies a whole array into the buffer and advances the write position
+ * @param out Write position, advanced past the block
+ * @param values Array to copy
+ */
+template <typename T>
+static void WriteBlock(unsigned char*& out, const std::vector<T>& values) {
+    if (!values.empty()) {
+        memcpy(out, values.data(), values.size() * sizeof(T));
+    }
+    out += values.size() * sizeof(T);
+}
+
+/**
+ * Copies a block out of the buffer into an array of the given size
+ * @param in Read position, advanced past the block
+ * @param values Array to resize and fill
+ * @param count Number of elements in the block
+ */
+template <typename T>
+static void ReadBlock(const unsigned char*& in, std::vector<T>& values, uint32_t count) {
+    values.resize(count);
+    if (count > 0) {
+        memcpy(values.data(), in, count * sizeof(T));
+    }
+    in += count * sizeof(T);
+}
+
+/**
+ * Serializes a world into the snapshot, replacing its previous contents
+ * @param state Fixed part of the world
+ * @param asteroids Asteroid store to copy
+ * @param projectiles Projectile store to copy
+ * @param powerups Power-ups to copy
+ * @param commands Deferred object commands to copy
+ */
+void WorldSnapshot::Write(const WorldState& state, const AsteroidStore& asteroids,
+    const ProjectileStore& projectiles, const std::vector<PowerUp>& powerups,
+    const std::vector<ObjectCommand>& commands) {
+    WorldSnapshotHeader header;
+    header.magic = WORLD_SNAPSHOT_MAGIC;
+    header.version = WORLD_SNAPSHOT_VERSION;
+    header.asteroidCount = (uint32_t)asteroids.size();
+    header.projectileCount = (uint32_t)projectiles.size();
+    header.powerupCount = (uint32_t)powerups.size();
+    header.commandCount = (uint32_t)commands.size();
+    header.size = (uint32_t)SnapshotSize(header);
+
+    bytes.resize(header.size);
+    unsigned char* out = bytes.data();
+    memcpy(out, &header, sizeof(header));
+    out += sizeof(header);
+    memcpy(out, &state, sizeof(state));
+    out += sizeof(state);
+
+    const EntityStore* stores[] = { &asteroids, &projectiles };
+    for (const EntityStore* store : stores) {
+        WriteBlock(out, store->px);
+        WriteBlock(out, store->py);
+        WriteBlock(out, store->vx);
+        WriteBlock(out, store->vy);
+        WriteBlock(out, store->radius);
+        WriteBlock(out, store->lifetime);
+        WriteBlock(out, store->prevPx);
+        WriteBlock(out, store->prevPy);
+        if (store == &asteroids) {
+            WriteBlock(out, asteroids.sizes);
+            WriteBlock(out, asteroids.rotation);
+            WriteBlock(out, asteroids.rotationSpeed);
+            WriteBlock(out, asteroids.colorIndex);
+        }
+    }
+    WriteBlock(out, powerups);
+    WriteBlock(out, commands);
+}
+
+/**
+ * Restores a world from the snapshot
+ * The targets are resized to the stored counts and overwritten completely
+ * Projectile handles issued before the restore become stale
+ * @param state Receives the fixed part of the world
+ * @param asteroids Asteroid store to overwrite
+ * @param projectiles Projectile store to overwrite
+ * @param powerups Power-up vector to overwrite
+ * @param commands Deferred command list to overwrite
+ * @return False (targets untouched) if the snapshot is empty or invalid
+ */
+bool WorldSnapshot::Read(WorldState& state, AsteroidStore& asteroids,
+    ProjectileStore& projectiles, std::vector<PowerUp>& powerups,
+    std::vector<ObjectCommand>& commands) const {
+    if (!IsValid()) return false;
+
+    WorldSnapshotHeader header;
+    const unsigned char* in = bytes.data();
+    memcpy(&header, in, sizeof(header));
+    in += sizeof(header);
+    memcpy(&state, in, sizeof(state));
+    in += sizeof(state);
+
+    EntityStore* stores[] = { &asteroids, &projectiles };
+    for (EntityStore* store : stores) {
+        uint32_t count = store == &asteroids ? header.asteroidCount : header.projectileCount;
+        ReadBlock(in, store->px, count);
+        ReadBlock(in, store->py, count);
+        ReadBlock(in, store->vx, count);
+        ReadBlock(in, store->vy, count);
+        ReadBlock(in, store->radius, count);
+        ReadBlock(in, store->lifetime, count);
+        ReadBlock(in, store->prevPx, count);
+        ReadBlock(in, store->prevPy, count);
+        if (store == &asteroids) {
+            ReadBlock(in, asteroids.sizes, count);
+            ReadBlock(in, asteroids.rotation, count);
+            ReadBlock(in, asteroids.rotationSpeed, count);
+            ReadBlock(in, asteroids.colorIndex, count);
+        }
+    }
+    projectiles.ResetHandles();
+    ReadBlock(in, powerups, header.powerupCount);
+    ReadBlock(in, commands, header.commandCount);
+    return true;
+}
+
+/**
+ * Checks magic, version and that the buffer size matches the stored counts
+ * @return True if the snapshot can be read
+ */
+bool WorldSnapshot::IsValid() const {
+    if (bytes.size() < sizeof(WorldSnapshotHeader)) return false;
+
+    WorldSnapshotHeader header;
+    memcpy(&header, bytes.data(), sizeof(header));
+    return header.magic == WORLD_SNAPSHOT_MAGIC
+        && header.version == WORLD_SNAPSHOT_VERSION
+        && header.size == bytes.size()
+        && SnapshotSize(header) == bytes.size();
+}
+
+/**
+ * Writes the snapshot to a file (quick-save, test fixtures)
+ * @param path Output file
+ * @return False if the snapshot is empty or the file cannot be written
+ */
+bool WorldSnapshot::SaveToFile(const char* path) const {
+    if (!IsValid()) return false;
+
+    std::ofstream file(path, std::ios::binary);
+    if (!file.is_open()) return false;
+    file.write(reinterpret_cast<const char*>(bytes.data()), (std::streamsize)bytes.size());
+    return file.good();
+}
+
+/**
+ * Reads a snapshot file written by SaveToFile()
+ * @param path Snapshot file to read
+ * @return False if the file is missing, truncated or of another version
+ */
+bool WorldSnapshot::LoadFromFile(const char* path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) return false;
+
+    bytes.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    if (!IsValid()) {
+        bytes.clear();
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,84 @@
+#ifndef WORLDSNAPSHOT_H
+#define WORLDSNAPSHOT_H
+
+#include "objectmanager.h"
+#include "random.h"
+#include "spaceship.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#define WORLD_SNAPSHOT_MAGIC 0x444C5257u  // "WRLD" in little-endian byte order
+#define WORLD_SNAPSHOT_VERSION 1          // Bumped whenever a block layout changes
+
+/**
+ * Header at the start of every world snapshot
+ * The counts size the array blocks that follow the fixed WorldState block
+ */
+struct WorldSnapshotHeader {
+    uint32_t magic;             // WORLD_SNAPSHOT_MAGIC
+    uint32_t version;           // WORLD_SNAPSHOT_VERSION
+    uint32_t size;              // Total snapshot size in bytes, header included
+    uint32_t asteroidCount;     // Slots of the asteroid store
+    uint32_t projectileCount;   // Slots of the projectile store
+    uint32_t powerupCount;      // Entries of the power-up vector
+    uint32_t commandCount;      // Deferred object commands not applied yet
+};
+
+/**
+ * Fixed-size part of a world snapshot: everything that is not an entity array
+ * Every member is trivially copyable, so the block is copied as raw bytes
+ */
+struct WorldState {
+    Spaceship player;               // Player ship
+    int score;                      // Current score
+    int highScore;                  // Best score so far
+    int level;                      // Current level
+    float projectileCooldown;       // Time until the next shot may be fired
+    float asteroidSpawnTimer;       // Time since the last edge spawn
+    int currentItem;                // Held power-up item
+    int amountRapid;                // Remaining rapid fire shots
+    bool hasRapid;                  // Whether rapid fire is active
+    bool hasShield;                 // Whether the shield item is active
+    ObjectManagerState objects;     // Object manager timers and pool statistics
+    RandomStreamState random;       // Simulation random streams
+};
+
+/**
+ * WorldSnapshot class holding a serialized game world in one flat buffer
+ *
+ * Layout: WorldSnapshotHeader, WorldState, then one block per entity array
+ * (asteroid px, py, vx, vy, radius, lifetime, prevPx, prevPy, sizes,
+ * rotation, rotationSpeed, colorIndex; projectile px ... prevPy; power-ups;
+ * deferred commands), each block stored as its raw element bytes
+ *
+ * Writing and reading copy whole arrays with memcpy; the buffer and the
+ * stores keep their capacity, so repeated save/restore does not allocate
+ * once both have grown to the world's size. Files are only portable between
+ * builds with the same type layout and byte order
+ */
+class WorldSnapshot {
+private:
+    std::vector<unsigned char> bytes;   // Header followed by all blocks
+
+public:
+    void Write(const WorldState& state /* Fixed part of the world */,
+        const AsteroidStore& asteroids /* Asteroid store to copy */,
+        const ProjectileStore& projectiles /* Projectile store to copy */,
+        const std::vector<PowerUp>& powerups /* Power-ups to copy */,
+        const std::vector<ObjectCommand>& commands /* Deferred commands to copy */);
+    bool Read(WorldState& state /* Receives the fixed part */,
+        AsteroidStore& asteroids /* Resized and overwritten */,
+        ProjectileStore& projectiles /* Resized and overwritten */,
+        std::vector<PowerUp>& powerups /* Resized and overwritten */,
+        std::vector<ObjectCommand>& commands /* Resized and overwritten */) const;
+
+    bool IsValid() const;
+    bool SaveToFile(const char* path /* Output file */) const;
+    bool LoadFromFile(const char* path /* Snapshot file to read */);
+
+    const unsigned char* GetData() const { return bytes.data(); }
+    size_t GetSize() const { return bytes.size(); }
+};
+
+#endif